@@ -22,6 +22,7 @@ public class MDMetaDataEditor : ModuleRules
 				"GameplayTagsEditor",
 				"InputCore",
 				"KismetWidgets",
+				"Projects",
 				"Slate",
 				"SlateCore",
 				"UMG",
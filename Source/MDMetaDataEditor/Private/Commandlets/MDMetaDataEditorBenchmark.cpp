@@ -0,0 +1,561 @@
+// Copyright Dylan Dumesnil. All Rights Reserved.
+
+
+#include "MDMetaDataEditorBenchmark.h"
+
+#include "Config/MDMetaDataEditorConfig.h"
+#include "Config/MDMetaDataEditorUserConfig.h"
+#include "Customizations/MDMetaDataEditorFieldView.h"
+#include "EdGraphSchema_K2.h"
+#include "Engine/Blueprint.h"
+#include "Engine/BlueprintGeneratedClass.h"
+#include "GameFramework/Actor.h"
+#include "K2Node_FunctionEntry.h"
+#include "Kismet2/BlueprintEditorUtils.h"
+#include "Kismet2/KismetEditorUtilities.h"
+#include "Misc/FileHelper.h"
+#include "UObject/Package.h"
+
+namespace MDMDEB_Private
+{
+	// Each benchmark gets its own packages, a previous one's Blueprints may not have been garbage collected yet
+	int32 NumBenchmarks = 0;
+
+	FEdGraphPinType MakePinType(int32 Index)
+	{
+		FEdGraphPinType PinType;
+		switch (Index % 6)
+		{
+		case 0:
+			PinType.PinCategory = UEdGraphSchema_K2::PC_Boolean;
+			break;
+		case 1:
+			PinType.PinCategory = UEdGraphSchema_K2::PC_Int;
+			break;
+		case 2:
+			PinType.PinCategory = UEdGraphSchema_K2::PC_Real;
+			PinType.PinSubCategory = UEdGraphSchema_K2::PC_Double;
+			break;
+		case 3:
+			PinType.PinCategory = UEdGraphSchema_K2::PC_String;
+			break;
+		case 4:
+			PinType.PinCategory = UEdGraphSchema_K2::PC_Object;
+			PinType.PinSubCategoryObject = AActor::StaticClass();
+			break;
+		default:
+			PinType.PinCategory = UEdGraphSchema_K2::PC_Struct;
+			PinType.PinSubCategoryObject = TBaseStructure<FVector>::Get();
+			break;
+		}
+
+		if (Index % 4 == 3)
+		{
+			PinType.ContainerType = EPinContainerType::Array;
+		}
+
+		return PinType;
+	}
+
+	TArray<FMDMetaDataKey> MakeSyntheticKeys(int32 NumKeys)
+	{
+		constexpr int32 NumKeyTypes = static_cast<int32>(EMDMetaDataEditorKeyType::ValueList) + 1;
+
+		TArray<FMDMetaDataKey> Keys;
+		Keys.Reserve(NumKeys);
+		for (int32 Index = 0; Index < NumKeys; ++Index)
+		{
+			FMDMetaDataKey& Key = Keys.Emplace_GetRef();
+			Key.Key = FMDMetaDataEditorBenchmark::MakeKeyName(Index);
+			Key.KeyType = static_cast<EMDMetaDataEditorKeyType>(Index % NumKeyTypes);
+			Key.Description = FString::Printf(TEXT("Synthetic benchmark key %d."), Index);
+
+			if (Index % 3 == 0)
+			{
+				Key.Category = FString::Printf(TEXT("Benchmark|Group %d"), Index % 5);
+			}
+
+			if (Key.KeyType == EMDMetaDataEditorKeyType::ValueList)
+			{
+				Key.ValueList = { TEXT("A"), TEXT("B"), TEXT("C") };
+			}
+
+			if (Index % 10 == 9)
+			{
+				Key.SetFunctionsOnly();
+				continue;
+			}
+
+			// Every other key takes a specific property type, the rest stay wildcards
+			if (Index % 2 == 1)
+			{
+				FMDMetaDataEditorPropertyType PropertyType;
+				PropertyType.SetFromGraphPinType(MakePinType(Index / 2));
+				Key.SetSupportedProperty(MoveTemp(PropertyType));
+			}
+
+			if (Index % 7 == 6)
+			{
+				Key.SetRequiredMetaData(FMDMetaDataEditorBenchmark::MakeKeyName(Index - 1));
+			}
+
+			if (Index % 11 == 10)
+			{
+				Key.AddIncompatibleMetaData(FMDMetaDataEditorBenchmark::MakeKeyName(Index - 2));
+			}
+		}
+
+		return Keys;
+	}
+
+	FBPVariableDescription MakeVariableDescription(const FName& Name, const FEdGraphPinType& PinType, uint64 PropertyFlags)
+	{
+		FBPVariableDescription Variable;
+		Variable.VarName = Name;
+		Variable.VarGuid = FGuid::NewGuid();
+		Variable.FriendlyName = FName::NameToDisplayString(Name.ToString(), PinType.PinCategory == UEdGraphSchema_K2::PC_Boolean);
+		Variable.VarType = PinType;
+		Variable.PropertyFlags = PropertyFlags;
+		Variable.Category = UEdGraphSchema_K2::VR_DefaultCategory;
+		return Variable;
+	}
+
+	int64 GetMetaDataAllocatedSize(const TArray<FBPVariableDescription>& Variables)
+	{
+		int64 Size = 0;
+		for (const FBPVariableDescription& Variable : Variables)
+		{
+			Size += Variable.MetaDataArray.GetAllocatedSize();
+			for (const FBPVariableMetaDataEntry& Entry : Variable.MetaDataArray)
+			{
+				Size += Entry.DataValue.GetAllocatedSize();
+			}
+		}
+
+		return Size;
+	}
+
+	int64 GetMetaDataAllocatedSize(const FField* Field)
+	{
+		const TMap<FName, FString>* MetaDataMap = Field->GetMetaDataMap();
+		if (MetaDataMap == nullptr)
+		{
+			return 0;
+		}
+
+		int64 Size = MetaDataMap->GetAllocatedSize();
+		for (const TPair<FName, FString>& Pair : *MetaDataMap)
+		{
+			Size += Pair.Value.GetAllocatedSize();
+		}
+
+		return Size;
+	}
+}
+
+FMDMetaDataEditorBenchmarkScenario FMDMetaDataEditorBenchmarkScenario::MakePerf()
+{
+	FMDMetaDataEditorBenchmarkScenario Perf;
+	Perf.NumBlueprints = 1;
+	Perf.NumVariables = 1000;
+	Perf.NumFunctions = 200;
+	Perf.NumKeys = 500;
+	return Perf;
+}
+
+bool FMDMetaDataEditorBenchmarkScenario::operator==(const FMDMetaDataEditorBenchmarkScenario& Other) const
+{
+	return NumBlueprints == Other.NumBlueprints
+		&& NumVariables == Other.NumVariables
+		&& NumFunctions == Other.NumFunctions
+		&& NumParams == Other.NumParams
+		&& NumLocals == Other.NumLocals
+		&& NumKeys == Other.NumKeys;
+}
+
+double FMDMetaDataEditorBenchmarkResult::GetTotalSeconds() const
+{
+	double Total = 0;
+	for (double Seconds : SampleSeconds)
+	{
+		Total += Seconds;
+	}
+	return Total;
+}
+
+FMDMetaDataEditorBenchmark::FMDMetaDataEditorBenchmark(const FMDMetaDataEditorBenchmarkScenario& InScenario)
+	: Scenario(InScenario)
+{
+	Scenario.NumBlueprints = FMath::Max(Scenario.NumBlueprints, 1);
+	++MDMDEB_Private::NumBenchmarks;
+
+	UMDMetaDataEditorConfig* Config = GetMutableDefault<UMDMetaDataEditorConfig>();
+	OriginalKeys = MoveTemp(Config->MetaDataKeys);
+	Config->MetaDataKeys = MDMDEB_Private::MakeSyntheticKeys(Scenario.NumKeys);
+	Config->RebuildKeyIndex();
+
+	bOriginalMarkBlueprintModified = GetDefault<UMDMetaDataEditorUserConfig>()->bMarkBlueprintModifiedOnMetaDataChange;
+}
+
+FMDMetaDataEditorBenchmark::~FMDMetaDataEditorBenchmark()
+{
+	UMDMetaDataEditorConfig* Config = GetMutableDefault<UMDMetaDataEditorConfig>();
+	Config->MetaDataKeys = MoveTemp(OriginalKeys);
+	Config->RebuildKeyIndex();
+
+	GetMutableDefault<UMDMetaDataEditorUserConfig>()->bMarkBlueprintModifiedOnMetaDataChange = bOriginalMarkBlueprintModified;
+
+	// Let the next garbage collection clean up the synthetic Blueprints
+	for (const FSyntheticBlueprint& Synthetic : Blueprints)
+	{
+		if (IsValid(Synthetic.Blueprint))
+		{
+			Synthetic.Blueprint->ClearFlags(RF_Standalone | RF_Public);
+			Synthetic.Blueprint->MarkAsGarbage();
+		}
+	}
+}
+
+FName FMDMetaDataEditorBenchmark::MakeKeyName(int32 Index)
+{
+	return *FString::Printf(TEXT("MDBenchmarkKey%d"), Index);
+}
+
+FMDMetaDataEditorBenchmarkSample FMDMetaDataEditorBenchmark::GenerateBlueprints()
+{
+	for (int32 Index = 0; Index < Scenario.NumBlueprints; ++Index)
+	{
+		FSyntheticBlueprint Synthetic = CreateSyntheticBlueprint(Index);
+		if (IsValid(Synthetic.Blueprint))
+		{
+			Blueprints.Add(MoveTemp(Synthetic));
+		}
+	}
+
+	return { Blueprints.Num(), GetMetaDataAllocatedSize() };
+}
+
+FMDMetaDataEditorBenchmarkSample FMDMetaDataEditorBenchmark::EnumerateKeys() const
+{
+	const UMDMetaDataEditorConfig* Config = GetDefault<UMDMetaDataEditorConfig>();
+
+	int64 NumKeys = 0;
+	auto CountKey = [&NumKeys](int32, const FMDMetaDataKey&) { ++NumKeys; };
+
+	for (const FSyntheticBlueprint& Synthetic : Blueprints)
+	{
+		for (TFieldIterator<FProperty> It(Synthetic.Blueprint->GeneratedClass, EFieldIteratorFlags::ExcludeSuper); It; ++It)
+		{
+			Config->ForEachVariableMetaDataKey(Synthetic.Blueprint, *It, CountKey);
+		}
+
+		for (int32 Index = 0; Index < Synthetic.FunctionEntries.Num(); ++Index)
+		{
+			Config->ForEachFunctionMetaDataKey(Synthetic.Blueprint, CountKey);
+		}
+
+		ForEachFunctionProperty(Synthetic, [Config, &Synthetic, &CountKey](UK2Node_FunctionEntry*, FProperty* Property)
+		{
+			if (Property->HasAnyPropertyFlags(CPF_Parm))
+			{
+				Config->ForEachParameterMetaDataKey(Synthetic.Blueprint, Property, CountKey);
+			}
+			else
+			{
+				Config->ForEachLocalVariableMetaDataKey(Synthetic.Blueprint, Property, CountKey);
+			}
+		});
+	}
+
+	// Enumerating memoizes the candidate keys of each Blueprint class in the index
+	return { NumKeys, static_cast<int64>(Config->GetKeyIndex().GetAllocatedSize()) };
+}
+
+FMDMetaDataEditorBenchmarkSample FMDMetaDataEditorBenchmark::AddFieldViewRows() const
+{
+	FMDMetaDataEditorBenchmarkSample Sample;
+	auto AddRows = [&Sample](const TSharedRef<FMDMetaDataEditorFieldView>& FieldView)
+	{
+		FieldView->AddMetadataValueEditor([&FieldView, &Sample](int32, const FMDMetaDataKey& Key)
+		{
+			FieldView->GetMetadataValue(Key.Key);
+			Key.GetKeyDisplayText();
+			Key.GetToolTipText();
+			Key.GetFilterText();
+			++Sample.NumItems;
+		});
+
+		Sample.AllocatedBytes += FieldView->GetAllocatedSize();
+	};
+
+	for (const FSyntheticBlueprint& Synthetic : Blueprints)
+	{
+		for (TFieldIterator<FProperty> It(Synthetic.Blueprint->GeneratedClass, EFieldIteratorFlags::ExcludeSuper); It; ++It)
+		{
+			AddRows(MakeShared<FMDMetaDataEditorFieldView>(*It, Synthetic.Blueprint));
+		}
+
+		for (UK2Node_FunctionEntry* EntryNode : Synthetic.FunctionEntries)
+		{
+			AddRows(MakeShared<FMDMetaDataEditorFieldView>(EntryNode, Synthetic.Blueprint));
+		}
+
+		ForEachFunctionProperty(Synthetic, [&Synthetic, &AddRows](UK2Node_FunctionEntry* EntryNode, FProperty* Property)
+		{
+			if (Property->HasAnyPropertyFlags(CPF_Parm))
+			{
+				AddRows(MakeShared<FMDMetaDataEditorFieldView>(Property, EntryNode));
+			}
+			else
+			{
+				AddRows(MakeShared<FMDMetaDataEditorFieldView>(Property, Synthetic.Blueprint));
+			}
+		});
+	}
+
+	Sample.AllocatedBytes += GetDefault<UMDMetaDataEditorConfig>()->GetKeyIndex().GetAllocatedSize();
+	return Sample;
+}
+
+FMDMetaDataEditorBenchmarkSample FMDMetaDataEditorBenchmark::SetMetadataValues(const FString& Value, bool bMarkBlueprintModified) const
+{
+	GetMutableDefault<UMDMetaDataEditorUserConfig>()->bMarkBlueprintModifiedOnMetaDataChange = bMarkBlueprintModified;
+
+	const FName Key = MakeKeyName(0);
+
+	int64 NumSet = 0;
+	for (const FSyntheticBlueprint& Synthetic : Blueprints)
+	{
+		for (TFieldIterator<FProperty> It(Synthetic.Blueprint->GeneratedClass, EFieldIteratorFlags::ExcludeSuper); It; ++It)
+		{
+			MakeShared<FMDMetaDataEditorFieldView>(*It, Synthetic.Blueprint)->SetMetadataValue(Key, Value);
+			++NumSet;
+		}
+
+		ForEachFunctionProperty(Synthetic, [&Key, &Value, &NumSet](UK2Node_FunctionEntry* EntryNode, FProperty* Property)
+		{
+			if (Property->HasAnyPropertyFlags(CPF_Parm))
+			{
+				MakeShared<FMDMetaDataEditorFieldView>(Property, EntryNode)->SetMetadataValue(Key, Value);
+				++NumSet;
+			}
+		});
+	}
+
+	GetMutableDefault<UMDMetaDataEditorUserConfig>()->bMarkBlueprintModifiedOnMetaDataChange = bOriginalMarkBlueprintModified;
+
+	return { NumSet, GetMetaDataAllocatedSize() };
+}
+
+FMDMetaDataEditorBenchmarkSample FMDMetaDataEditorBenchmark::CompileBlueprints() const
+{
+	for (const FSyntheticBlueprint& Synthetic : Blueprints)
+	{
+		FBlueprintEditorUtils::MarkBlueprintAsStructurallyModified(Synthetic.Blueprint);
+		FKismetEditorUtilities::CompileBlueprint(Synthetic.Blueprint, EBlueprintCompileOptions::SkipGarbageCollection);
+	}
+
+	return { Blueprints.Num(), GetMetaDataAllocatedSize() };
+}
+
+// Variables are added directly instead of through FBlueprintEditorUtils to avoid regenerating the skeleton class for each one
+FMDMetaDataEditorBenchmark::FSyntheticBlueprint FMDMetaDataEditorBenchmark::CreateSyntheticBlueprint(int32 BlueprintIndex) const
+{
+	using namespace MDMDEB_Private;
+
+	const FString BlueprintName = FString::Printf(TEXT("BP_MDMetaDataEditorBenchmark_%d"), BlueprintIndex);
+	UPackage* Package = CreatePackage(*FString::Printf(TEXT("/Temp/MDMetaDataEditorBenchmark/%d/%s"), NumBenchmarks, *BlueprintName));
+
+	FSyntheticBlueprint Result;
+	Result.Blueprint = FKismetEditorUtilities::CreateBlueprint(AActor::StaticClass(), Package, *BlueprintName, BPTYPE_Normal, UBlueprint::StaticClass(), UBlueprintGeneratedClass::StaticClass());
+	if (!IsValid(Result.Blueprint))
+	{
+		return Result;
+	}
+
+	UBlueprint* Blueprint = Result.Blueprint;
+
+	Blueprint->NewVariables.Reserve(Blueprint->NewVariables.Num() + Scenario.NumVariables);
+	for (int32 Index = 0; Index < Scenario.NumVariables; ++Index)
+	{
+		Blueprint->NewVariables.Add(MakeVariableDescription(*FString::Printf(TEXT("Variable%d"), Index), MakePinType(Index), CPF_Edit | CPF_BlueprintVisible | CPF_DisableEditOnInstance));
+	}
+
+	for (int32 FunctionIndex = 0; FunctionIndex < Scenario.NumFunctions; ++FunctionIndex)
+	{
+		UEdGraph* Graph = FBlueprintEditorUtils::CreateNewGraph(Blueprint, *FString::Printf(TEXT("Function%d"), FunctionIndex), UEdGraph::StaticClass(), UEdGraphSchema_K2::StaticClass());
+		FBlueprintEditorUtils::AddFunctionGraph<UClass>(Blueprint, Graph, true, nullptr);
+
+		TArray<UK2Node_FunctionEntry*> EntryNodes;
+		Graph->GetNodesOfClass(EntryNodes);
+		if (EntryNodes.IsEmpty())
+		{
+			continue;
+		}
+
+		UK2Node_FunctionEntry* EntryNode = EntryNodes[0];
+		Result.FunctionEntries.Add(EntryNode);
+
+		for (int32 Index = 0; Index < Scenario.NumParams; ++Index)
+		{
+			// Function inputs are outputs of the entry node
+			EntryNode->CreateUserDefinedPin(*FString::Printf(TEXT("Param%d"), Index), MakePinType(Index), EGPD_Output, false);
+		}
+
+		for (int32 Index = 0; Index < Scenario.NumLocals; ++Index)
+		{
+			FBPVariableDescription& Local = EntryNode->LocalVariables.Add_GetRef(MakeVariableDescription(*FString::Printf(TEXT("Local%d"), Index), MakePinType(Index), CPF_BlueprintVisible));
+
+			// Gives the compiler extension local variable meta data to propagate
+			Local.SetMetaData(MakeKeyName(Index), TEXT("true"));
+		}
+	}
+
+	FBlueprintEditorUtils::MarkBlueprintAsStructurallyModified(Blueprint);
+	FKismetEditorUtilities::CompileBlueprint(Blueprint, EBlueprintCompileOptions::SkipGarbageCollection);
+
+	return Result;
+}
+
+void FMDMetaDataEditorBenchmark::ForEachFunctionProperty(const FSyntheticBlueprint& Synthetic, const TFunctionRef<void(UK2Node_FunctionEntry*, FProperty*)>& Func)
+{
+	const UClass* GeneratedClass = Synthetic.Blueprint->GeneratedClass;
+	if (!IsValid(GeneratedClass))
+	{
+		return;
+	}
+
+	for (UK2Node_FunctionEntry* EntryNode : Synthetic.FunctionEntries)
+	{
+		const UFunction* Function = GeneratedClass->FindFunctionByName(EntryNode->GetGraph()->GetFName());
+		if (!IsValid(Function))
+		{
+			continue;
+		}
+
+		for (TFieldIterator<FProperty> It(Function); It; ++It)
+		{
+			Func(EntryNode, *It);
+		}
+	}
+}
+
+int64 FMDMetaDataEditorBenchmark::GetMetaDataAllocatedSize() const
+{
+	int64 Size = 0;
+	for (const FSyntheticBlueprint& Synthetic : Blueprints)
+	{
+		Size += MDMDEB_Private::GetMetaDataAllocatedSize(Synthetic.Blueprint->NewVariables);
+		for (const UK2Node_FunctionEntry* EntryNode : Synthetic.FunctionEntries)
+		{
+			Size += MDMDEB_Private::GetMetaDataAllocatedSize(EntryNode->LocalVariables);
+		}
+
+		if (IsValid(Synthetic.Blueprint->GeneratedClass))
+		{
+			for (TFieldIterator<FProperty> It(Synthetic.Blueprint->GeneratedClass, EFieldIteratorFlags::ExcludeSuper); It; ++It)
+			{
+				Size += MDMDEB_Private::GetMetaDataAllocatedSize(*It);
+			}
+		}
+
+		ForEachFunctionProperty(Synthetic, [&Size](UK2Node_FunctionEntry*, FProperty* Property)
+		{
+			Size += MDMDEB_Private::GetMetaDataAllocatedSize(Property);
+		});
+	}
+
+	return Size;
+}
+
+bool FMDMetaDataEditorBenchmark::WriteCsv(const FString& Path, const FMDMetaDataEditorBenchmarkScenario& Scenario, const TArray<FMDMetaDataEditorBenchmarkResult>& Results)
+{
+	FString Csv = TEXT("Benchmark,Samples,Items,TotalMs,AvgMs,MinMs,MaxMs,AllocatedKB,Blueprints,Variables,Functions,Params,Locals,Keys\n");
+	for (const FMDMetaDataEditorBenchmarkResult& Result : Results)
+	{
+		Csv += FString::Printf(TEXT("%s,%d,%lld,%.3f,%.3f,%.3f,%.3f,%lld,%d,%d,%d,%d,%d,%d\n"),
+			*Result.Name, Result.SampleSeconds.Num(), Result.NumItems,
+			Result.GetTotalSeconds() * 1000.0, Result.GetAverageSeconds() * 1000.0, Result.GetMinSeconds() * 1000.0, Result.GetMaxSeconds() * 1000.0,
+			Result.AllocatedBytes / 1024, Scenario.NumBlueprints, Scenario.NumVariables, Scenario.NumFunctions, Scenario.NumParams, Scenario.NumLocals, Scenario.NumKeys);
+	}
+
+	return FFileHelper::SaveStringToFile(Csv, *Path);
+}
+
+bool FMDMetaDataEditorBenchmark::ReadBaseline(const FString& Path, const FMDMetaDataEditorBenchmarkScenario& Scenario, TMap<FString, FMDMetaDataEditorBenchmarkBaselineEntry>& OutEntries)
+{
+	TArray<FString> Lines;
+	if (!FFileHelper::LoadFileToStringArray(Lines, *Path) || Lines.IsEmpty())
+	{
+		return false;
+	}
+
+	TArray<FString> Header;
+	Lines[0].ParseIntoArray(Header, TEXT(","));
+	const int32 NameColumn = Header.IndexOfByKey(TEXT("Benchmark"));
+	const int32 MinColumn = Header.IndexOfByKey(TEXT("MinMs"));
+	const int32 MemoryColumn = Header.IndexOfByKey(TEXT("AllocatedKB"));
+	const int32 FirstScenarioColumn = Header.IndexOfByKey(TEXT("Blueprints"));
+	if (NameColumn == INDEX_NONE || MinColumn == INDEX_NONE || FirstScenarioColumn == INDEX_NONE)
+	{
+		return false;
+	}
+
+	constexpr int32 NumScenarioColumns = 6;
+
+	for (int32 LineIndex = 1; LineIndex < Lines.Num(); ++LineIndex)
+	{
+		TArray<FString> Columns;
+		Lines[LineIndex].ParseIntoArray(Columns, TEXT(","));
+		if (Columns.Num() < FirstScenarioColumn + NumScenarioColumns)
+		{
+			continue;
+		}
+
+		FMDMetaDataEditorBenchmarkScenario LineScenario;
+		LineScenario.NumBlueprints = FCString::Atoi(*Columns[FirstScenarioColumn]);
+		LineScenario.NumVariables = FCString::Atoi(*Columns[FirstScenarioColumn + 1]);
+		LineScenario.NumFunctions = FCString::Atoi(*Columns[FirstScenarioColumn + 2]);
+		LineScenario.NumParams = FCString::Atoi(*Columns[FirstScenarioColumn + 3]);
+		LineScenario.NumLocals = FCString::Atoi(*Columns[FirstScenarioColumn + 4]);
+		LineScenario.NumKeys = FCString::Atoi(*Columns[FirstScenarioColumn + 5]);
+
+		// A baseline can hold several scenarios, eg. the commandlet's default one and the perf one
+		if (!(LineScenario == Scenario))
+		{
+			continue;
+		}
+
+		FMDMetaDataEditorBenchmarkBaselineEntry& Entry = OutEntries.Add(Columns[NameColumn]);
+		Entry.MinMs = FCString::Atod(*Columns[MinColumn]);
+		Entry.AllocatedKB = (MemoryColumn != INDEX_NONE) ? FCString::Atoi64(*Columns[MemoryColumn]) : 0;
+	}
+
+	return true;
+}
+
+bool FMDMetaDataEditorBenchmark::IsWithinBudget(const FMDMetaDataEditorBenchmarkResult& Result, const FMDMetaDataEditorBenchmarkBaselineEntry& Baseline, double TimeMargin, double MemoryMargin, TArray<FString>& OutErrors)
+{
+	bool bIsWithinBudget = true;
+
+	const double MinMs = Result.GetMinSeconds() * 1000.0;
+	const double TimeBudgetMs = Baseline.MinMs * (1.0 + TimeMargin);
+	if (MinMs > TimeBudgetMs)
+	{
+		OutErrors.Add(FString::Printf(TEXT("%s took %.3f ms, over its budget of %.3f ms (baseline %.3f ms + %.0f%%)"),
+			*Result.Name, MinMs, TimeBudgetMs, Baseline.MinMs, TimeMargin * 100.0));
+		bIsWithinBudget = false;
+	}
+
+	// Allocations are measured from the containers themselves so they're deterministic, no noise floor is needed
+	const int64 AllocatedKB = Result.AllocatedBytes / 1024;
+	const int64 MemoryBudgetKB = static_cast<int64>(Baseline.AllocatedKB * (1.0 + MemoryMargin));
+	if (AllocatedKB > MemoryBudgetKB)
+	{
+		OutErrors.Add(FString::Printf(TEXT("%s allocated %lld KB, over its budget of %lld KB (baseline %lld KB + %.0f%%)"),
+			*Result.Name, AllocatedKB, MemoryBudgetKB, Baseline.AllocatedKB, MemoryMargin * 100.0));
+		bIsWithinBudget = false;
+	}
+
+	return bIsWithinBudget;
+}
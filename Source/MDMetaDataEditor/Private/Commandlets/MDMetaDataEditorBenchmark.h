@@ -0,0 +1,128 @@
+// Copyright Dylan Dumesnil. All Rights Reserved.
+
+#pragma once
+
+#include "Containers/Array.h"
+#include "Containers/Map.h"
+#include "Containers/UnrealString.h"
+#include "HAL/PlatformTime.h"
+#include "Templates/Function.h"
+#include "Types/MDMetaDataKey.h"
+
+class FProperty;
+class UBlueprint;
+class UK2Node_FunctionEntry;
+
+// The size of the synthetic Blueprints and meta data keys a benchmark runs against
+struct FMDMetaDataEditorBenchmarkScenario
+{
+	int32 NumBlueprints = 10;
+	int32 NumVariables = 100;
+	int32 NumFunctions = 20;
+	int32 NumParams = 5;
+	int32 NumLocals = 5;
+	int32 NumKeys = 200;
+
+	// The perf scenario: a 1,000 variable Blueprint with 200 functions and 500 keys
+	static FMDMetaDataEditorBenchmarkScenario MakePerf();
+
+	bool operator==(const FMDMetaDataEditorBenchmarkScenario& Other) const;
+};
+
+// What a single sample of a benchmark did
+struct FMDMetaDataEditorBenchmarkSample
+{
+	// How many operations the sample performed (keys visited, rows, values set, Blueprints compiled)
+	int64 NumItems = 0;
+
+	// The bytes held by the containers the sample filled (key index, field view caches, meta data maps),
+	// measured from the containers themselves so it doesn't depend on the allocator or other work in the process
+	int64 AllocatedBytes = 0;
+};
+
+struct FMDMetaDataEditorBenchmarkResult
+{
+	FString Name;
+	TArray<double> SampleSeconds;
+	int64 NumItems = 0;
+	// The largest allocation of any sample
+	int64 AllocatedBytes = 0;
+
+	double GetTotalSeconds() const;
+	double GetAverageSeconds() const { return SampleSeconds.IsEmpty() ? 0 : GetTotalSeconds() / SampleSeconds.Num(); }
+	double GetMinSeconds() const { return SampleSeconds.IsEmpty() ? 0 : FMath::Min(SampleSeconds); }
+	double GetMaxSeconds() const { return SampleSeconds.IsEmpty() ? 0 : FMath::Max(SampleSeconds); }
+};
+
+struct FMDMetaDataEditorBenchmarkBaselineEntry
+{
+	double MinMs = 0;
+	int64 AllocatedKB = 0;
+};
+
+/**
+ * Generates synthetic Blueprints and meta data keys and runs the meta data editor's hot paths over them.
+ * Shared by the benchmark commandlet and the MDMetaDataEditor.Perf automation tests so both measure the same work.
+ * The config's keys are swapped for synthetic ones while this is alive, the field views always read from the config CDO.
+ */
+class FMDMetaDataEditorBenchmark
+{
+public:
+	explicit FMDMetaDataEditorBenchmark(const FMDMetaDataEditorBenchmarkScenario& InScenario);
+	~FMDMetaDataEditorBenchmark();
+
+	const FMDMetaDataEditorBenchmarkScenario& GetScenario() const { return Scenario; }
+	bool HasBlueprints() const { return !Blueprints.IsEmpty(); }
+
+	FMDMetaDataEditorBenchmarkSample GenerateBlueprints();
+	FMDMetaDataEditorBenchmarkSample EnumerateKeys() const;
+
+	// Building real rows needs a details panel, so this covers the per-row work a field view does for each key it would add
+	FMDMetaDataEditorBenchmarkSample AddFieldViewRows() const;
+
+	// Sets Value on every variable and parameter, bMarkBlueprintModified picks the path the user setting would
+	FMDMetaDataEditorBenchmarkSample SetMetadataValues(const FString& Value, bool bMarkBlueprintModified) const;
+
+	// Covers the compiler extension's ProcessBlueprintCompiled, which copies the param and local variable meta data
+	FMDMetaDataEditorBenchmarkSample CompileBlueprints() const;
+
+	static FName MakeKeyName(int32 Index);
+
+	// Func returns the FMDMetaDataEditorBenchmarkSample of the work it did
+	template<typename FuncType>
+	static void Measure(FMDMetaDataEditorBenchmarkResult& Result, FuncType&& Func)
+	{
+		const double StartTime = FPlatformTime::Seconds();
+		const FMDMetaDataEditorBenchmarkSample Sample = Func();
+		Result.SampleSeconds.Add(FPlatformTime::Seconds() - StartTime);
+		Result.NumItems = Sample.NumItems;
+		Result.AllocatedBytes = FMath::Max(Result.AllocatedBytes, Sample.AllocatedBytes);
+	}
+
+	static bool WriteCsv(const FString& Path, const FMDMetaDataEditorBenchmarkScenario& Scenario, const TArray<FMDMetaDataEditorBenchmarkResult>& Results);
+
+	// Reads the entries of a CSV written by WriteCsv that were recorded with the same scenario size
+	static bool ReadBaseline(const FString& Path, const FMDMetaDataEditorBenchmarkScenario& Scenario, TMap<FString, FMDMetaDataEditorBenchmarkBaselineEntry>& OutEntries);
+
+	// Compares the fastest sample since it's the least affected by other work on the machine, OutErrors is filled for each budget that was exceeded
+	static bool IsWithinBudget(const FMDMetaDataEditorBenchmarkResult& Result, const FMDMetaDataEditorBenchmarkBaselineEntry& Baseline, double TimeMargin, double MemoryMargin, TArray<FString>& OutErrors);
+
+private:
+	struct FSyntheticBlueprint
+	{
+		UBlueprint* Blueprint = nullptr;
+		TArray<UK2Node_FunctionEntry*> FunctionEntries;
+	};
+
+	FSyntheticBlueprint CreateSyntheticBlueprint(int32 BlueprintIndex) const;
+	static void ForEachFunctionProperty(const FSyntheticBlueprint& Synthetic, const TFunctionRef<void(UK2Node_FunctionEntry*, FProperty*)>& Func);
+
+	// The bytes held by the meta data of the synthetic Blueprints' variables and of their compiled properties
+	int64 GetMetaDataAllocatedSize() const;
+
+	FMDMetaDataEditorBenchmarkScenario Scenario;
+	TArray<FSyntheticBlueprint> Blueprints;
+
+	TArray<FMDMetaDataKey> OriginalKeys;
+	bool bOriginalMarkBlueprintModified = false;
+};
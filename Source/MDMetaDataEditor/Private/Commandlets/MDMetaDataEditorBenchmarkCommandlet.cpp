@@ -0,0 +1,175 @@
+// Copyright Dylan Dumesnil. All Rights Reserved.
+
+
+#include "MDMetaDataEditorBenchmarkCommandlet.h"
+
+#include "Commandlets/MDMetaDataEditorBenchmark.h"
+#include "MDMetaDataEditorModule.h"
+#include "Misc/Parse.h"
+#include "Misc/Paths.h"
+
+namespace MDMDEBC_Private
+{
+	struct FBenchmarkSettings
+	{
+		FMDMetaDataEditorBenchmarkScenario Scenario;
+		int32 NumIterations = 5;
+		FString OutputPath;
+
+		// A CSV previously written by this commandlet to compare against, the run fails if a benchmark exceeds its budget
+		FString BaselinePath;
+		// How much slower than the baseline a benchmark's fastest sample may be, as a fraction of the baseline
+		double TimeMargin = 0.25;
+		// How much more memory than the baseline a benchmark may allocate, as a fraction of the baseline
+		double MemoryMargin = 0.5;
+
+		void Parse(const FString& Params)
+		{
+			if (FParse::Param(*Params, TEXT("Perf")))
+			{
+				Scenario = FMDMetaDataEditorBenchmarkScenario::MakePerf();
+			}
+
+			FParse::Value(*Params, TEXT("Blueprints="), Scenario.NumBlueprints);
+			FParse::Value(*Params, TEXT("Variables="), Scenario.NumVariables);
+			FParse::Value(*Params, TEXT("Functions="), Scenario.NumFunctions);
+			FParse::Value(*Params, TEXT("Params="), Scenario.NumParams);
+			FParse::Value(*Params, TEXT("Locals="), Scenario.NumLocals);
+			FParse::Value(*Params, TEXT("Keys="), Scenario.NumKeys);
+			FParse::Value(*Params, TEXT("Iterations="), NumIterations);
+			FParse::Value(*Params, TEXT("Baseline="), BaselinePath);
+			FParse::Value(*Params, TEXT("Margin="), TimeMargin);
+			FParse::Value(*Params, TEXT("MemoryMargin="), MemoryMargin);
+
+			if (!FParse::Value(*Params, TEXT("Output="), OutputPath))
+			{
+				OutputPath = FPaths::ProjectSavedDir() / TEXT("MDMetaDataEditor") / TEXT("Benchmark.csv");
+			}
+
+			Scenario.NumBlueprints = FMath::Max(Scenario.NumBlueprints, 1);
+			NumIterations = FMath::Max(NumIterations, 1);
+		}
+	};
+}
+
+UMDMetaDataEditorBenchmarkCommandlet::UMDMetaDataEditorBenchmarkCommandlet()
+{
+	IsClient = false;
+	IsServer = false;
+	IsEditor = true;
+	LogToConsole = true;
+}
+
+int32 UMDMetaDataEditorBenchmarkCommandlet::Main(const FString& Params)
+{
+	using namespace MDMDEBC_Private;
+
+	FBenchmarkSettings Settings;
+	Settings.Parse(Params);
+
+	FMDMetaDataEditorBenchmark Benchmark(Settings.Scenario);
+
+	FMDMetaDataEditorBenchmarkResult GenerateResult = { TEXT("GenerateBlueprints") };
+	FMDMetaDataEditorBenchmark::Measure(GenerateResult, [&Benchmark]()
+	{
+		return Benchmark.GenerateBlueprints();
+	});
+
+	if (!Benchmark.HasBlueprints())
+	{
+		UE_LOG(LogMDMetaDataEditor, Error, TEXT("Failed to generate any benchmark Blueprints"));
+		return 1;
+	}
+
+	FMDMetaDataEditorBenchmarkResult KeyEnumerationResult = { TEXT("KeyEnumeration") };
+	FMDMetaDataEditorBenchmarkResult FieldViewRowsResult = { TEXT("FieldViewRows") };
+	FMDMetaDataEditorBenchmarkResult SetMetadataValuePatchResult = { TEXT("SetMetadataValue_Patch") };
+	FMDMetaDataEditorBenchmarkResult SetMetadataValueMarkModifiedResult = { TEXT("SetMetadataValue_MarkModified") };
+	FMDMetaDataEditorBenchmarkResult CompileResult = { TEXT("CompileBlueprints") };
+
+	for (int32 Iteration = 0; Iteration < Settings.NumIterations; ++Iteration)
+	{
+		FMDMetaDataEditorBenchmark::Measure(KeyEnumerationResult, [&Benchmark]()
+		{
+			return Benchmark.EnumerateKeys();
+		});
+
+		FMDMetaDataEditorBenchmark::Measure(FieldViewRowsResult, [&Benchmark]()
+		{
+			return Benchmark.AddFieldViewRows();
+		});
+
+		// Patching the compiled class directly vs. marking the Blueprint modified, which is what the user setting chooses between.
+		// The value changes every iteration and differs between the two modes so no set is skipped as unchanged
+		FMDMetaDataEditorBenchmark::Measure(SetMetadataValuePatchResult, [&Benchmark, Iteration]()
+		{
+			return Benchmark.SetMetadataValues(FString::Printf(TEXT("Patch%d"), Iteration), false);
+		});
+
+		FMDMetaDataEditorBenchmark::Measure(SetMetadataValueMarkModifiedResult, [&Benchmark, Iteration]()
+		{
+			return Benchmark.SetMetadataValues(FString::Printf(TEXT("MarkModified%d"), Iteration), true);
+		});
+
+		FMDMetaDataEditorBenchmark::Measure(CompileResult, [&Benchmark]()
+		{
+			return Benchmark.CompileBlueprints();
+		});
+	}
+
+	const TArray<FMDMetaDataEditorBenchmarkResult> Results = { GenerateResult, KeyEnumerationResult, FieldViewRowsResult, SetMetadataValuePatchResult, SetMetadataValueMarkModifiedResult, CompileResult };
+	for (const FMDMetaDataEditorBenchmarkResult& Result : Results)
+	{
+		UE_LOG(LogMDMetaDataEditor, Display, TEXT("%s: %d sample(s) of %lld item(s), avg %.3f ms, min %.3f ms, max %.3f ms, %lld KB allocated"),
+			*Result.Name, Result.SampleSeconds.Num(), Result.NumItems, Result.GetAverageSeconds() * 1000.0, Result.GetMinSeconds() * 1000.0, Result.GetMaxSeconds() * 1000.0, Result.AllocatedBytes / 1024);
+	}
+
+	if (!FMDMetaDataEditorBenchmark::WriteCsv(Settings.OutputPath, Settings.Scenario, Results))
+	{
+		UE_LOG(LogMDMetaDataEditor, Error, TEXT("Failed to write benchmark results to [%s]"), *Settings.OutputPath);
+		return 1;
+	}
+
+	UE_LOG(LogMDMetaDataEditor, Display, TEXT("Wrote benchmark results to [%s]"), *Settings.OutputPath);
+
+	if (!Settings.BaselinePath.IsEmpty())
+	{
+		TMap<FString, FMDMetaDataEditorBenchmarkBaselineEntry> Baseline;
+		if (!FMDMetaDataEditorBenchmark::ReadBaseline(Settings.BaselinePath, Settings.Scenario, Baseline))
+		{
+			UE_LOG(LogMDMetaDataEditor, Error, TEXT("Failed to read benchmark baseline [%s]"), *Settings.BaselinePath);
+			return 1;
+		}
+
+		bool bIsWithinBudget = true;
+		for (const FMDMetaDataEditorBenchmarkResult& Result : Results)
+		{
+			const FMDMetaDataEditorBenchmarkBaselineEntry* Entry = Baseline.Find(Result.Name);
+			if (Entry == nullptr)
+			{
+				UE_LOG(LogMDMetaDataEditor, Warning, TEXT("Baseline [%s] has no entry for %s with this scenario size, it will not be compared"), *Settings.BaselinePath, *Result.Name);
+				continue;
+			}
+
+			TArray<FString> Errors;
+			if (!FMDMetaDataEditorBenchmark::IsWithinBudget(Result, *Entry, Settings.TimeMargin, Settings.MemoryMargin, Errors))
+			{
+				for (const FString& Error : Errors)
+				{
+					UE_LOG(LogMDMetaDataEditor, Error, TEXT("%s"), *Error);
+				}
+
+				bIsWithinBudget = false;
+			}
+		}
+
+		if (!bIsWithinBudget)
+		{
+			return 2;
+		}
+
+		UE_LOG(LogMDMetaDataEditor, Display, TEXT("All benchmarks are within budget of baseline [%s]"), *Settings.BaselinePath);
+	}
+
+	return 0;
+}
@@ -0,0 +1,29 @@
+// Copyright Dylan Dumesnil. All Rights Reserved.
+
+#pragma once
+
+#include "Commandlets/Commandlet.h"
+#include "MDMetaDataEditorBenchmarkCommandlet.generated.h"
+
+/**
+ * Generates synthetic Blueprints and meta data keys, then times the meta data editor's hot paths and writes the results as CSV.
+ * Run headless with: UnrealEditor-Cmd <Project> -run=MDMetaDataEditorBenchmark -nullrhi -unattended
+ *
+ * Optional params (defaults in brackets):
+ * -Blueprints=[10] -Variables=[100] -Functions=[20] -Params=[5] -Locals=[5] -Keys=[200] -Iterations=[5]
+ * -Output=[Saved/MDMetaDataEditor/Benchmark.csv]
+ * -Perf runs the perf scenario: 1 Blueprint with 1,000 variables, 200 functions and 500 keys
+ *
+ * Budgets, pass a CSV from a previous run to fail (exit code 2) if a benchmark regressed against it:
+ * -Baseline=<Path> -Margin=[0.25] -MemoryMargin=[0.5]
+ */
+UCLASS()
+class UMDMetaDataEditorBenchmarkCommandlet : public UCommandlet
+{
+	GENERATED_BODY()
+
+public:
+	UMDMetaDataEditorBenchmarkCommandlet();
+
+	virtual int32 Main(const FString& Params) override;
+};
@@ -9,6 +9,7 @@
 #include "Engine/UserDefinedStruct.h"
 #include "GameplayTagContainer.h"
 #include "MDMetaDataEditorModule.h"
+#include "MDMetaDataEditorStats.h"
 #include "Modules/ModuleManager.h"
 #include "WidgetBlueprint.h"
 
@@ -259,6 +260,15 @@ void UMDMetaDataEditorConfig::PostInitProperties()
 			SupportedPropertyType.FixUp();
 		}
 	}
+
+	RebuildKeyIndex();
+}
+
+void UMDMetaDataEditorConfig::PostReloadConfig(FProperty* PropertyThatWasLoaded)
+{
+	Super::PostReloadConfig(PropertyThatWasLoaded);
+
+	RebuildKeyIndex();
 }
 
 FText UMDMetaDataEditorConfig::GetSectionText() const
@@ -266,103 +276,157 @@ FText UMDMetaDataEditorConfig::GetSectionText() const
 	return INVTEXT("Meta Data Editor");
 }
 
-void UMDMetaDataEditorConfig::ForEachVariableMetaDataKey(const UBlueprint* Blueprint, const FProperty* Property, const TFunctionRef<void(const FMDMetaDataKey&)>& Func) const
+void UMDMetaDataEditorConfig::ForEachVariableMetaDataKey(const UBlueprint* Blueprint, const FProperty* Property, const TFunctionRef<void(int32, const FMDMetaDataKey&)>& Func) const
 {
-	ForEachPropertyMetaDataKey(Blueprint, Property, [&Func](const FMDMetaDataKey& Key)
-	{
-		if (Key.bCanBeUsedOnVariables)
-		{
-			Func(Key);
-		}
-	});
+	ForEachIndexedMetaDataKey(EMDMetaDataKeyFieldKind::Variable, Blueprint, Property, Func);
 }
 
-void UMDMetaDataEditorConfig::ForEachLocalVariableMetaDataKey(const UBlueprint* Blueprint, const FProperty* Property, const TFunctionRef<void(const FMDMetaDataKey&)>& Func) const
+void UMDMetaDataEditorConfig::ForEachLocalVariableMetaDataKey(const UBlueprint* Blueprint, const FProperty* Property, const TFunctionRef<void(int32, const FMDMetaDataKey&)>& Func) const
 {
-	ForEachPropertyMetaDataKey(Blueprint, Property, [&Func](const FMDMetaDataKey& Key)
-	{
-		if (Key.bCanBeUsedOnLocalVariables)
-		{
-			Func(Key);
-		}
-	});
+	ForEachIndexedMetaDataKey(EMDMetaDataKeyFieldKind::LocalVariable, Blueprint, Property, Func);
 }
 
-void UMDMetaDataEditorConfig::ForEachParameterMetaDataKey(const UBlueprint* Blueprint, const FProperty* Property, const TFunctionRef<void(const FMDMetaDataKey&)>& Func) const
+void UMDMetaDataEditorConfig::ForEachParameterMetaDataKey(const UBlueprint* Blueprint, const FProperty* Property, const TFunctionRef<void(int32, const FMDMetaDataKey&)>& Func) const
 {
-	ForEachPropertyMetaDataKey(Blueprint, Property, [&Func](const FMDMetaDataKey& Key)
-	{
-		if (Key.bCanBeUsedOnFunctionParameters)
-		{
-			Func(Key);
-		}
-	});
+	ForEachIndexedMetaDataKey(EMDMetaDataKeyFieldKind::FunctionParameter, Blueprint, Property, Func);
 }
 
-void UMDMetaDataEditorConfig::ForEachPropertyMetaDataKey(const UBlueprint* Blueprint, const FProperty* Property, const TFunctionRef<void(const FMDMetaDataKey&)>& Func) const
+void UMDMetaDataEditorConfig::ForEachPropertyMetaDataKey(const UBlueprint* Blueprint, const FProperty* Property, const TFunctionRef<void(int32, const FMDMetaDataKey&)>& Func) const
 {
-	if (!IsValid(Blueprint) || Property == nullptr)
+	ForEachIndexedMetaDataKey(EMDMetaDataKeyFieldKind::Property, Blueprint, Property, Func);
+}
+
+void UMDMetaDataEditorConfig::ForEachStructPropertyMetaDataKey(const FProperty* Property, const TFunctionRef<void(int32, const FMDMetaDataKey&)>& Func) const
+{
+	// Test as if the struct were a basic blueprint
+	ForEachPropertyMetaDataKey(UBlueprint::StaticClass()->GetDefaultObject<UBlueprint>(), Property, Func);
+}
+
+void UMDMetaDataEditorConfig::ForEachFunctionMetaDataKey(const UBlueprint* Blueprint, const TFunctionRef<void(int32, const FMDMetaDataKey&)>& Func) const
+{
+	if (!IsValid(Blueprint))
 	{
 		return;
 	}
 
-	for (const FMDMetaDataKey& Key : MetaDataKeys)
+	MDMDE_SCOPE_CYCLE_COUNTER(STAT_MDMetaDataEditor_ForEachMetaDataKey);
+
+	// Function keys don't filter on property type, so every candidate is a match
+	int32 NumMatched = 0;
+	GetKeyIndex().ForEachCandidateKey(EMDMetaDataKeyFieldKind::Function, Blueprint, [this, &Func, &NumMatched](int32 Index)
 	{
-		if (!Key.DoesSupportBlueprint(Blueprint))
-		{
-			continue;
-		}
+		++NumMatched;
+		Func(Index, MetaDataKeys[Index]);
+	});
 
-		if (Key.DoesSupportProperty(Property))
-		{
-			Func(Key);
-		}
-	}
+	MDMDE_INC_COUNTER(MDMetaDataEditor_KeysEvaluated, NumMatched);
+	MDMDE_INC_COUNTER(MDMetaDataEditor_KeysMatched, NumMatched);
 }
 
-void UMDMetaDataEditorConfig::ForEachStructPropertyMetaDataKey(const FProperty* Property, const TFunctionRef<void(const FMDMetaDataKey&)>& Func) const
+void UMDMetaDataEditorConfig::ForEachStructMetaDataKey(const TFunctionRef<void(int32, const FMDMetaDataKey&)>& Func) const
 {
-	// Test as if the struct were a basic blueprint
-	ForEachPropertyMetaDataKey(UBlueprint::StaticClass()->GetDefaultObject<UBlueprint>(), Property, Func);
+	MDMDE_SCOPE_CYCLE_COUNTER(STAT_MDMetaDataEditor_ForEachMetaDataKey);
+
+	int32 NumMatched = 0;
+	GetKeyIndex().ForEachCandidateKey(EMDMetaDataKeyFieldKind::Struct, nullptr, [this, &Func, &NumMatched](int32 Index)
+	{
+		++NumMatched;
+		Func(Index, MetaDataKeys[Index]);
+	});
+
+	MDMDE_INC_COUNTER(MDMetaDataEditor_KeysEvaluated, NumMatched);
+	MDMDE_INC_COUNTER(MDMetaDataEditor_KeysMatched, NumMatched);
 }
 
-void UMDMetaDataEditorConfig::ForEachFunctionMetaDataKey(const UBlueprint* Blueprint, const TFunctionRef<void(const FMDMetaDataKey&)>& Func) const
+void UMDMetaDataEditorConfig::RebuildKeyIndex()
 {
-	if (!IsValid(Blueprint))
+	KeyIndex.Build(MetaDataKeys);
+}
+
+const FMDMetaDataKeyIndex& UMDMetaDataEditorConfig::GetKeyIndex() const
+{
+	// Rebuilt lazily after key edits, this is also a safety net in case the keys were changed without going through PostEditChangeProperty
+	if (!KeyIndex.IsBuiltFor(MetaDataKeys))
 	{
-		return;
+		KeyIndex.Build(MetaDataKeys);
 	}
 
+	return KeyIndex;
+}
+
+void UMDMetaDataEditorConfig::ResetCachedKeyText() const
+{
 	for (const FMDMetaDataKey& Key : MetaDataKeys)
 	{
-		if (!Key.bCanBeUsedByFunctions || !Key.DoesSupportBlueprint(Blueprint))
-		{
-			continue;
-		}
-
-		Func(Key);
+		Key.ResetCachedText();
 	}
 }
 
-void UMDMetaDataEditorConfig::ForEachStructMetaDataKey(const TFunctionRef<void(const FMDMetaDataKey&)>& Func) const
+void UMDMetaDataEditorConfig::ForEachIndexedMetaDataKey(EMDMetaDataKeyFieldKind FieldKind, const UBlueprint* Blueprint, const FProperty* Property, const TFunctionRef<void(int32, const FMDMetaDataKey&)>& Func) const
 {
-	for (const FMDMetaDataKey& Key : MetaDataKeys)
+	if (!IsValid(Blueprint) || Property == nullptr)
 	{
-		if (!Key.bCanBeUsedByStructs)
+		return;
+	}
+
+	MDMDE_SCOPE_CYCLE_COUNTER(STAT_MDMetaDataEditor_ForEachMetaDataKey);
+
+	const FMDMetaDataKeyIndex& Index = GetKeyIndex();
+
+	TBitArray<> SupportingKeys;
+	Index.GatherKeysSupportingProperty(Property, SupportingKeys);
+
+	int32 NumEvaluated = 0;
+	int32 NumMatched = 0;
+	Index.ForEachCandidateKey(FieldKind, Blueprint, [this, &SupportingKeys, &Func, &NumEvaluated, &NumMatched](int32 KeyIndex)
+	{
+		++NumEvaluated;
+		if (SupportingKeys[KeyIndex])
 		{
-			continue;
+			++NumMatched;
+			Func(KeyIndex, MetaDataKeys[KeyIndex]);
 		}
+	});
 
-		Func(Key);
-	}
+	MDMDE_INC_COUNTER(MDMetaDataEditor_KeysEvaluated, NumEvaluated);
+	MDMDE_INC_COUNTER(MDMetaDataEditor_KeysMatched, NumMatched);
 }
 
 #if WITH_EDITOR
 void UMDMetaDataEditorConfig::PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent)
 {
+	Super::PostEditChangeProperty(PropertyChangedEvent);
+
+	// Key edits only need the lookup caches invalidated, they're rebuilt on the next query so editing many keys in a row stays cheap
+	const FName MemberPropertyName = PropertyChangedEvent.GetMemberPropertyName();
+	if (MemberPropertyName == GET_MEMBER_NAME_CHECKED(UMDMetaDataEditorConfig, MetaDataKeys))
+	{
+		KeyIndex.Reset();
+		return;
+	}
+
+	// A change without a property (eg. resetting the whole config) may have replaced the keys too
+	if (MemberPropertyName == NAME_None)
+	{
+		KeyIndex.Reset();
+	}
+
+	if (FMDMetaDataEditorModule* Module = FModuleManager::GetModulePtr<FMDMetaDataEditorModule>(TEXT("MDMetaDataEditor")))
+	{
+		Module->ApplyConfig();
+	}
+}
+
+void UMDMetaDataEditorConfig::PostEditUndo()
+{
+	Super::PostEditUndo();
+
+	// Undo restores the keys in place, which the index can't detect when the number of keys stays the same
+	KeyIndex.Reset();
+
 	if (FMDMetaDataEditorModule* Module = FModuleManager::GetModulePtr<FMDMetaDataEditorModule>(TEXT("MDMetaDataEditor")))
 	{
-		Module->RestartModule();
+		Module->ApplyConfig();
 	}
 }
 #endif //WITH_EDITOR
@@ -2,6 +2,7 @@
 
 #pragma once
 
+#include "Config/MDMetaDataEditorKeyIndex.h"
 #include "EdGraphSchema_K2.h"
 #include "Engine/DeveloperSettings.h"
 #include "Types/MDMetaDataKey.h"
@@ -17,20 +18,32 @@ class UMDMetaDataEditorConfig : public UDeveloperSettings
 {
 	GENERATED_BODY()
 
+	// Swaps in synthetic keys for the duration of a benchmark
+	friend class FMDMetaDataEditorBenchmark;
+
 public:
 	UMDMetaDataEditorConfig();
 
 	virtual void PostInitProperties() override;
+	virtual void PostReloadConfig(FProperty* PropertyThatWasLoaded) override;
 
 	virtual FText GetSectionText() const override;
 
-	void ForEachVariableMetaDataKey(const UBlueprint* Blueprint, const FProperty* Property, const TFunctionRef<void(const FMDMetaDataKey&)>& Func) const;
-	void ForEachLocalVariableMetaDataKey(const UBlueprint* Blueprint, const FProperty* Property, const TFunctionRef<void(const FMDMetaDataKey&)>& Func) const;
-	void ForEachParameterMetaDataKey(const UBlueprint* Blueprint, const FProperty* Property, const TFunctionRef<void(const FMDMetaDataKey&)>& Func) const;
-	void ForEachPropertyMetaDataKey(const UBlueprint* Blueprint, const FProperty* Property, const TFunctionRef<void(const FMDMetaDataKey&)>& Func) const;
-	void ForEachStructPropertyMetaDataKey(const FProperty* Property, const TFunctionRef<void(const FMDMetaDataKey&)>& Func) const;
-	void ForEachFunctionMetaDataKey(const UBlueprint* Blueprint, const TFunctionRef<void(const FMDMetaDataKey&)>& Func) const;
-	void ForEachStructMetaDataKey(const TFunctionRef<void(const FMDMetaDataKey&)>& Func) const;
+	// Func is called with the index of each key in MetaDataKeys, which is also its index in the key index and dependency graph
+	void ForEachVariableMetaDataKey(const UBlueprint* Blueprint, const FProperty* Property, const TFunctionRef<void(int32, const FMDMetaDataKey&)>& Func) const;
+	void ForEachLocalVariableMetaDataKey(const UBlueprint* Blueprint, const FProperty* Property, const TFunctionRef<void(int32, const FMDMetaDataKey&)>& Func) const;
+	void ForEachParameterMetaDataKey(const UBlueprint* Blueprint, const FProperty* Property, const TFunctionRef<void(int32, const FMDMetaDataKey&)>& Func) const;
+	void ForEachPropertyMetaDataKey(const UBlueprint* Blueprint, const FProperty* Property, const TFunctionRef<void(int32, const FMDMetaDataKey&)>& Func) const;
+	void ForEachStructPropertyMetaDataKey(const FProperty* Property, const TFunctionRef<void(int32, const FMDMetaDataKey&)>& Func) const;
+	void ForEachFunctionMetaDataKey(const UBlueprint* Blueprint, const TFunctionRef<void(int32, const FMDMetaDataKey&)>& Func) const;
+	void ForEachStructMetaDataKey(const TFunctionRef<void(int32, const FMDMetaDataKey&)>& Func) const;
+
+	// Rebuilds the lookup index used by the ForEach functions, must be called whenever MetaDataKeys changes
+	void RebuildKeyIndex();
+	const FMDMetaDataKeyIndex& GetKeyIndex() const;
+
+	// The keys' text is rebuilt the next time it's used, eg. after the culture changes
+	void ResetCachedKeyText() const;
 
 	// If true, the metadata keys will automatically be sorted alphabetically
 	UPROPERTY(EditDefaultsOnly, Config, Category = "Meta Data Editor")
@@ -61,12 +74,17 @@ public:
 
 #if WITH_EDITOR
 	virtual void PostEditChangeProperty(struct FPropertyChangedEvent& PropertyChangedEvent) override;
+	virtual void PostEditUndo() override;
 #endif //WITH_EDITOR
 
 private:
+	void ForEachIndexedMetaDataKey(EMDMetaDataKeyFieldKind FieldKind, const UBlueprint* Blueprint, const FProperty* Property, const TFunctionRef<void(int32, const FMDMetaDataKey&)>& Func) const;
+
 	UFUNCTION()
 	TArray<FName> GetMetaDataKeyNames() const;
 
 	UPROPERTY(EditAnywhere, Config, Category = "Meta Data Keys", meta = (TitleProperty = "{Key} ({KeyType})"))
 	TArray<FMDMetaDataKey> MetaDataKeys;
+
+	mutable FMDMetaDataKeyIndex KeyIndex;
 };
@@ -0,0 +1,251 @@
+// Copyright Dylan Dumesnil. All Rights Reserved.
+
+#include "MDMetaDataEditorKeyDependencyGraph.h"
+
+#include "MDMetaDataEditorModule.h"
+#include "Types/MDMetaDataKey.h"
+
+namespace MDMDEKDG_Private
+{
+	void SetBit(uint32* Words, int32 Bit)
+	{
+		Words[Bit / NumBitsPerDWORD] |= (1u << (Bit % NumBitsPerDWORD));
+	}
+}
+
+void FMDMetaDataKeyDependencyGraph::Build(const TArray<FMDMetaDataKey>& InKeys)
+{
+	Reset();
+
+	NumKeys = InKeys.Num();
+
+	// Assign ids first so the masks can be sized once
+	for (const FMDMetaDataKey& Key : InKeys)
+	{
+		AddNameId(Key.Key);
+		if (!Key.RequiredMetaData.IsNone())
+		{
+			AddNameId(Key.RequiredMetaData);
+		}
+
+		for (const FName& IncompatibleKey : Key.IncompatibleMetaData)
+		{
+			if (!IncompatibleKey.IsNone())
+			{
+				AddNameId(IncompatibleKey);
+			}
+		}
+	}
+
+	NumWords = FMath::DivideAndRoundUp(NamesById.Num(), static_cast<int32>(NumBitsPerDWORD));
+	RequiredMasks.SetNumZeroed(NumKeys * NumWords);
+	IncompatibleMasks.SetNumZeroed(NumKeys * NumWords);
+	KeysWithDependencies.Init(false, NumKeys);
+
+	for (int32 KeyIndex = 0; KeyIndex < NumKeys; ++KeyIndex)
+	{
+		const FMDMetaDataKey& Key = InKeys[KeyIndex];
+		uint32* Required = RequiredMasks.GetData() + KeyIndex * NumWords;
+		uint32* Incompatible = IncompatibleMasks.GetData() + KeyIndex * NumWords;
+
+		if (Key.RequiredMetaData == Key.Key)
+		{
+			UE_LOG(LogMDMetaDataEditor, Warning, TEXT("Meta data key [%s] lists itself as its Required Meta Data, ignoring it"), *Key.Key.ToString());
+		}
+		else if (!Key.RequiredMetaData.IsNone())
+		{
+			MDMDEKDG_Private::SetBit(Required, NameIds.FindChecked(Key.RequiredMetaData));
+			KeysWithDependencies[KeyIndex] = true;
+		}
+
+		for (const FName& IncompatibleKey : Key.IncompatibleMetaData)
+		{
+			if (IncompatibleKey == Key.Key)
+			{
+				UE_LOG(LogMDMetaDataEditor, Warning, TEXT("Meta data key [%s] lists itself as Incompatible Meta Data, ignoring it"), *Key.Key.ToString());
+			}
+			else if (!IncompatibleKey.IsNone())
+			{
+				MDMDEKDG_Private::SetBit(Incompatible, NameIds.FindChecked(IncompatibleKey));
+				KeysWithDependencies[KeyIndex] = true;
+			}
+		}
+
+		for (int32 Word = 0; Word < NumWords; ++Word)
+		{
+			if ((Required[Word] & Incompatible[Word]) != 0)
+			{
+				UE_LOG(LogMDMetaDataEditor, Warning, TEXT("Meta data key [%s] requires [%s] but also lists it as incompatible, it will never be shown"), *Key.Key.ToString(), *Key.RequiredMetaData.ToString());
+				break;
+			}
+		}
+	}
+
+	DetectRequiredCycles(InKeys);
+}
+
+void FMDMetaDataKeyDependencyGraph::Reset()
+{
+	NumKeys = 0;
+	NumWords = 0;
+	NameIds.Reset();
+	NamesById.Reset();
+	RequiredMasks.Reset();
+	IncompatibleMasks.Reset();
+	KeysWithDependencies.Reset();
+}
+
+int32 FMDMetaDataKeyDependencyGraph::FindNameId(const FName& KeyName) const
+{
+	const int32* NameId = NameIds.Find(KeyName);
+	return (NameId != nullptr) ? *NameId : INDEX_NONE;
+}
+
+void FMDMetaDataKeyDependencyGraph::InitPresentKeys(TBitArray<>& OutPresentKeys) const
+{
+	OutPresentKeys.Init(false, NamesById.Num());
+}
+
+void FMDMetaDataKeyDependencyGraph::SetKeyPresent(TBitArray<>& PresentKeys, const FName& KeyName, bool bIsPresent) const
+{
+	const int32 NameId = FindNameId(KeyName);
+	if (PresentKeys.IsValidIndex(NameId))
+	{
+		PresentKeys[NameId] = bIsPresent;
+	}
+}
+
+bool FMDMetaDataKeyDependencyGraph::HasDependencies(int32 KeyIndex) const
+{
+	return KeysWithDependencies.IsValidIndex(KeyIndex) && KeysWithDependencies[KeyIndex];
+}
+
+bool FMDMetaDataKeyDependencyGraph::IsKeyVisible(int32 KeyIndex, const TBitArray<>& PresentKeys) const
+{
+	if (!HasDependencies(KeyIndex) || PresentKeys.Num() != NamesById.Num())
+	{
+		return true;
+	}
+
+	const uint32* Present = PresentKeys.GetData();
+	const uint32* Required = RequiredMasks.GetData() + KeyIndex * NumWords;
+	const uint32* Incompatible = IncompatibleMasks.GetData() + KeyIndex * NumWords;
+
+	uint32 Conflicts = 0;
+	for (int32 Word = 0; Word < NumWords; ++Word)
+	{
+		Conflicts |= (Required[Word] & ~Present[Word]) | (Incompatible[Word] & Present[Word]);
+	}
+
+	return Conflicts == 0;
+}
+
+void FMDMetaDataKeyDependencyGraph::GatherVisibleKeys(const TBitArray<>& PresentKeys, TBitArray<>& OutVisibleKeys) const
+{
+	OutVisibleKeys.Init(true, NumKeys);
+	if (PresentKeys.Num() != NamesById.Num())
+	{
+		return;
+	}
+
+	const uint32* Present = PresentKeys.GetData();
+	const uint32* Required = RequiredMasks.GetData();
+	const uint32* Incompatible = IncompatibleMasks.GetData();
+
+	// Keys without dependencies have empty masks, so there's no need to branch on them
+	for (int32 KeyIndex = 0; KeyIndex < NumKeys; ++KeyIndex)
+	{
+		uint32 Conflicts = 0;
+		for (int32 Word = 0; Word < NumWords; ++Word)
+		{
+			Conflicts |= (Required[Word] & ~Present[Word]) | (Incompatible[Word] & Present[Word]);
+		}
+
+		OutVisibleKeys[KeyIndex] = (Conflicts == 0);
+		Required += NumWords;
+		Incompatible += NumWords;
+	}
+}
+
+SIZE_T FMDMetaDataKeyDependencyGraph::GetAllocatedSize() const
+{
+	return NameIds.GetAllocatedSize()
+		+ NamesById.GetAllocatedSize()
+		+ RequiredMasks.GetAllocatedSize()
+		+ IncompatibleMasks.GetAllocatedSize()
+		+ KeysWithDependencies.GetAllocatedSize();
+}
+
+int32 FMDMetaDataKeyDependencyGraph::AddNameId(const FName& KeyName)
+{
+	if (const int32* NameId = NameIds.Find(KeyName))
+	{
+		return *NameId;
+	}
+
+	const int32 NameId = NamesById.Add(KeyName);
+	NameIds.Add(KeyName, NameId);
+	return NameId;
+}
+
+void FMDMetaDataKeyDependencyGraph::DetectRequiredCycles(const TArray<FMDMetaDataKey>& InKeys) const
+{
+	// Edges between key names, a name requires another if any key with that name does
+	TArray<TArray<int32>> RequiredByName;
+	RequiredByName.SetNum(NamesById.Num());
+	for (const FMDMetaDataKey& Key : InKeys)
+	{
+		if (!Key.RequiredMetaData.IsNone() && Key.RequiredMetaData != Key.Key)
+		{
+			RequiredByName[NameIds.FindChecked(Key.Key)].AddUnique(NameIds.FindChecked(Key.RequiredMetaData));
+		}
+	}
+
+	enum class EVisitState : uint8
+	{
+		Unvisited,
+		InPath,
+		Done
+	};
+
+	TArray<EVisitState> VisitStates;
+	VisitStates.Init(EVisitState::Unvisited, NamesById.Num());
+	TArray<int32> Path;
+
+	// Keys in a RequiredMetaData cycle can only be shown once one of them is set through other means (raw editor, C++, etc.)
+	TFunction<void(int32)> Visit = [&](int32 NameId)
+	{
+		VisitStates[NameId] = EVisitState::InPath;
+		Path.Push(NameId);
+
+		for (const int32 RequiredId : RequiredByName[NameId])
+		{
+			if (VisitStates[RequiredId] == EVisitState::InPath)
+			{
+				TStringBuilder<256> Cycle;
+				for (int32 i = Path.IndexOfByKey(RequiredId); i < Path.Num(); ++i)
+				{
+					Cycle << NamesById[Path[i]] << TEXT(" -> ");
+				}
+
+				Cycle << NamesById[RequiredId];
+				UE_LOG(LogMDMetaDataEditor, Warning, TEXT("Meta data keys have a Required Meta Data cycle and will be hidden until one of them is set: %s"), Cycle.ToString());
+			}
+			else if (VisitStates[RequiredId] == EVisitState::Unvisited)
+			{
+				Visit(RequiredId);
+			}
+		}
+
+		Path.Pop();
+		VisitStates[NameId] = EVisitState::Done;
+	};
+
+	for (int32 NameId = 0; NameId < NamesById.Num(); ++NameId)
+	{
+		if (VisitStates[NameId] == EVisitState::Unvisited)
+		{
+			Visit(NameId);
+		}
+	}
+}
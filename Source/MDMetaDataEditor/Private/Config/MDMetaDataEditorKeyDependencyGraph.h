@@ -0,0 +1,56 @@
+// Copyright Dylan Dumesnil. All Rights Reserved.
+
+#pragma once
+
+#include "Containers/Array.h"
+#include "Containers/BitArray.h"
+#include "Containers/Map.h"
+
+struct FMDMetaDataKey;
+
+/**
+ * The RequiredMetaData/IncompatibleMetaData dependencies of the config's meta data keys, compiled into bit masks.
+ * Every key name used by the config (including names only referenced as dependencies) gets an integer id,
+ * so the meta data on a field can be encoded as a bitset of ids and key visibility resolved with a few word operations.
+ * Stores indices into the key array it was built from and must be rebuilt whenever that array changes.
+ */
+class FMDMetaDataKeyDependencyGraph
+{
+public:
+	// Also logs any dependencies that can never be satisfied (self-references, cycles, contradictions)
+	void Build(const TArray<FMDMetaDataKey>& InKeys);
+	void Reset();
+
+	// Returns INDEX_NONE if no key in the config uses or depends on KeyName
+	int32 FindNameId(const FName& KeyName) const;
+	int32 GetNumNameIds() const { return NameIds.Num(); }
+
+	// Sizes OutPresentKeys for this graph with no keys set
+	void InitPresentKeys(TBitArray<>& OutPresentKeys) const;
+	void SetKeyPresent(TBitArray<>& PresentKeys, const FName& KeyName, bool bIsPresent) const;
+
+	bool HasDependencies(int32 KeyIndex) const;
+
+	// True if every required key is present and no incompatible key is, keys outside of the graph are always visible
+	bool IsKeyVisible(int32 KeyIndex, const TBitArray<>& PresentKeys) const;
+
+	// Resolves the visibility of every key in a single pass over the masks
+	void GatherVisibleKeys(const TBitArray<>& PresentKeys, TBitArray<>& OutVisibleKeys) const;
+
+	SIZE_T GetAllocatedSize() const;
+
+private:
+	int32 AddNameId(const FName& KeyName);
+	void DetectRequiredCycles(const TArray<FMDMetaDataKey>& InKeys) const;
+
+	int32 NumKeys = 0;
+	int32 NumWords = 0;
+
+	TMap<FName, int32> NameIds;
+	TArray<FName> NamesById;
+
+	// NumWords words per key, indexed by key index
+	TArray<uint32> RequiredMasks;
+	TArray<uint32> IncompatibleMasks;
+	TBitArray<> KeysWithDependencies;
+};
@@ -0,0 +1,420 @@
+// Copyright Dylan Dumesnil. All Rights Reserved.
+
+#include "MDMetaDataEditorKeyIndex.h"
+
+#include "EdGraphSchema_K2.h"
+#include "Engine/Blueprint.h"
+#include "HAL/PlatformTime.h"
+#include "MDMetaDataEditorModule.h"
+#include "MDMetaDataEditorStats.h"
+#include "Types/MDMetaDataKey.h"
+
+namespace MDMDEKI_Private
+{
+	uint32 LastBuildSerial = 0;
+
+	bool CanKeyBeUsedOn(const FMDMetaDataKey& Key, EMDMetaDataKeyFieldKind FieldKind)
+	{
+		switch (FieldKind)
+		{
+		case EMDMetaDataKeyFieldKind::Property:
+			return !Key.SupportedPropertyTypes.IsEmpty();
+		case EMDMetaDataKeyFieldKind::Variable:
+			return Key.bCanBeUsedOnVariables && !Key.SupportedPropertyTypes.IsEmpty();
+		case EMDMetaDataKeyFieldKind::LocalVariable:
+			return Key.bCanBeUsedOnLocalVariables && !Key.SupportedPropertyTypes.IsEmpty();
+		case EMDMetaDataKeyFieldKind::FunctionParameter:
+			return Key.bCanBeUsedOnFunctionParameters && !Key.SupportedPropertyTypes.IsEmpty();
+		case EMDMetaDataKeyFieldKind::Function:
+			return Key.bCanBeUsedByFunctions;
+		case EMDMetaDataKeyFieldKind::Struct:
+			return Key.bCanBeUsedByStructs;
+		default:
+			return false;
+		}
+	}
+
+	bool IsSubTypedCategory(const FName& Category)
+	{
+		return Category == UEdGraphSchema_K2::PC_Struct
+			|| Category == UEdGraphSchema_K2::PC_Object
+			|| Category == UEdGraphSchema_K2::PC_SoftObject
+			|| Category == UEdGraphSchema_K2::PC_Class
+			|| Category == UEdGraphSchema_K2::PC_SoftClass
+			|| Category == UEdGraphSchema_K2::PC_Enum
+			|| Category == UEdGraphSchema_K2::PC_Byte;
+	}
+}
+
+void FMDMetaDataKeyIndex::Build(const TArray<FMDMetaDataKey>& InKeys)
+{
+	MDMDE_SCOPE_CYCLE_COUNTER(STAT_MDMetaDataEditor_BuildKeyIndex);
+
+	const double StartTime = FPlatformTime::Seconds();
+
+	Reset();
+
+	Keys = &InKeys;
+	NumKeys = InKeys.Num();
+	BuildSerial = ++MDMDEKI_Private::LastBuildSerial;
+
+	KeyCategoryNodeIds.Reserve(NumKeys);
+
+	for (int32 KeyIndex = 0; KeyIndex < NumKeys; ++KeyIndex)
+	{
+		const FMDMetaDataKey& Key = InKeys[KeyIndex];
+
+		KeyCategoryNodeIds.Add(AddCategoryNodes(Key.Category));
+
+		// Always re-resolve, the index is rebuilt when classes may have been replaced
+		Key.ResetResolvedSupportedBlueprints();
+		Key.ResolveSupportedBlueprints();
+		Key.ResetCachedText();
+		Key.CacheText();
+		const TArray<const UClass*>& SupportedClasses = Key.GetResolvedSupportedBlueprints();
+		const bool bHasUnresolvedClass = Key.HasUnresolvedSupportedBlueprints();
+
+		for (uint8 KindIndex = 0; KindIndex < static_cast<uint8>(EMDMetaDataKeyFieldKind::Count); ++KindIndex)
+		{
+			const EMDMetaDataKeyFieldKind FieldKind = static_cast<EMDMetaDataKeyFieldKind>(KindIndex);
+			if (!MDMDEKI_Private::CanKeyBeUsedOn(Key, FieldKind))
+			{
+				continue;
+			}
+
+			FFieldKindBucket& Bucket = Buckets[KindIndex];
+			Bucket.AllKeys.Add(KeyIndex);
+
+			if (bHasUnresolvedClass)
+			{
+				Bucket.UnresolvedKeys.Add(KeyIndex);
+			}
+			else
+			{
+				for (const UClass* Class : SupportedClasses)
+				{
+					Bucket.KeysBySupportedBlueprint.FindOrAdd(Class).Add(KeyIndex);
+				}
+			}
+		}
+
+		for (auto It = Key.SupportedPropertyTypes.CreateConstIterator(); It; ++It)
+		{
+			const FMDMetaDataEditorPropertyType& PropertyType = *It;
+			const FPropertyTypeEntry Entry = { KeyIndex, It.GetId() };
+			if (PropertyType.PropertyType == UEdGraphSchema_K2::PC_Wildcard)
+			{
+				WildcardPropertyTypes.Add(Entry);
+			}
+			else if (MDMDEKI_Private::IsSubTypedCategory(PropertyType.PropertyType))
+			{
+				SubTypedPropertyTypes.FindOrAdd(PropertyType.PropertyType).Add(Entry);
+			}
+			else
+			{
+				PropertyTypesByPinCategory.FindOrAdd({ PropertyType.PropertyType, PropertyType.PropertySubType }).Add(Entry);
+			}
+		}
+	}
+
+	DependencyGraph.Build(InKeys);
+
+	BuildTimeSeconds = FPlatformTime::Seconds() - StartTime;
+
+	UE_LOG(LogMDMetaDataEditor, Verbose, TEXT("Built meta data key index for %d keys in %.3f ms (%llu bytes)"), NumKeys, BuildTimeSeconds * 1000.0, static_cast<uint64>(GetAllocatedSize()));
+}
+
+void FMDMetaDataKeyIndex::Reset()
+{
+	Keys = nullptr;
+	NumKeys = 0;
+	BuildSerial = 0;
+	BuildTimeSeconds = 0;
+
+	for (FFieldKindBucket& Bucket : Buckets)
+	{
+		Bucket.KeysBySupportedBlueprint.Reset();
+		Bucket.UnresolvedKeys.Reset();
+		Bucket.AllKeys.Reset();
+		Bucket.KeysByBlueprintClass.Reset();
+	}
+
+	WildcardPropertyTypes.Reset();
+	SubTypedPropertyTypes.Reset();
+	PropertyTypesByPinCategory.Reset();
+
+	DependencyGraph.Reset();
+
+	CategoryNodes.Reset();
+	CategoryNodeIdsByGroupName.Reset();
+	KeyCategoryNodeIds.Reset();
+}
+
+int32 FMDMetaDataKeyIndex::AddCategoryNodes(const FString& Category)
+{
+	TArray<FString> Segments;
+	Category.ParseIntoArray(Segments, TEXT("|"));
+
+	int32 NodeId = INDEX_NONE;
+	FString Path;
+	for (const FString& Segment : Segments)
+	{
+		if (Segment.TrimStartAndEnd().IsEmpty())
+		{
+			continue;
+		}
+
+		Path = Path.IsEmpty() ? Segment : FString::Printf(TEXT("%s|%s"), *Path, *Segment);
+
+		const FName GroupName = *Path;
+		if (const int32* ExistingNodeId = CategoryNodeIdsByGroupName.Find(GroupName))
+		{
+			NodeId = *ExistingNodeId;
+			continue;
+		}
+
+		FMDMetaDataCategoryNode& Node = CategoryNodes.AddDefaulted_GetRef();
+		Node.Segment = *Segment;
+		Node.DisplayName = FText::FromString(Segment);
+		Node.GroupName = GroupName;
+		Node.Path = Path;
+		Node.ParentId = NodeId;
+
+		NodeId = CategoryNodes.Num() - 1;
+		CategoryNodeIdsByGroupName.Add(GroupName, NodeId);
+	}
+
+	return NodeId;
+}
+
+void FMDMetaDataKeyIndex::ForEachCandidateKey(EMDMetaDataKeyFieldKind FieldKind, const UBlueprint* Blueprint, const TFunctionRef<void(int32)>& Func) const
+{
+	if (Keys == nullptr || FieldKind == EMDMetaDataKeyFieldKind::Count)
+	{
+		return;
+	}
+
+	const FFieldKindBucket& Bucket = Buckets[static_cast<uint8>(FieldKind)];
+
+	// Struct keys aren't filtered by Blueprint type
+	if (FieldKind == EMDMetaDataKeyFieldKind::Struct)
+	{
+		for (const int32 KeyIndex : Bucket.AllKeys)
+		{
+			Func(KeyIndex);
+		}
+		return;
+	}
+
+	if (!IsValid(Blueprint))
+	{
+		return;
+	}
+
+	const UClass* BlueprintClass = Blueprint->GetClass();
+	if (const TArray<int32>* MemoizedKeys = Bucket.KeysByBlueprintClass.Find(BlueprintClass))
+	{
+		for (const int32 KeyIndex : *MemoizedKeys)
+		{
+			Func(KeyIndex);
+		}
+		return;
+	}
+
+	TArray<int32> CandidateKeys;
+	GatherCandidateKeys(Bucket, Blueprint, CandidateKeys);
+
+	for (const int32 KeyIndex : CandidateKeys)
+	{
+		Func(KeyIndex);
+	}
+
+	// Unresolved keys can start passing once their class is loaded, so only memoize buckets that are fully resolved
+	if (Bucket.UnresolvedKeys.IsEmpty())
+	{
+		Bucket.KeysByBlueprintClass.Add(BlueprintClass, MoveTemp(CandidateKeys));
+	}
+}
+
+void FMDMetaDataKeyIndex::GatherCandidateKeys(const FFieldKindBucket& Bucket, const UBlueprint* Blueprint, TArray<int32>& OutKeys) const
+{
+	// Gather the buckets of every class this Blueprint is a type of
+	TArray<const TArray<int32>*, TInlineAllocator<8>> MatchingBuckets;
+	for (const UClass* Class = Blueprint->GetClass(); Class != nullptr; Class = Class->GetSuperClass())
+	{
+		if (const TArray<int32>* ClassKeys = Bucket.KeysBySupportedBlueprint.Find(Class))
+		{
+			MatchingBuckets.Add(ClassKeys);
+		}
+	}
+
+	if (MatchingBuckets.Num() == 1 && Bucket.UnresolvedKeys.IsEmpty())
+	{
+		OutKeys = *MatchingBuckets[0];
+		return;
+	}
+
+	// Merge back into key order, a key can be in multiple buckets if it supports multiple classes in the hierarchy
+	for (const TArray<int32>* ClassKeys : MatchingBuckets)
+	{
+		OutKeys.Append(*ClassKeys);
+	}
+
+	for (const int32 KeyIndex : Bucket.UnresolvedKeys)
+	{
+		if ((*Keys)[KeyIndex].DoesSupportBlueprint(Blueprint))
+		{
+			OutKeys.Add(KeyIndex);
+		}
+	}
+
+	OutKeys.Sort();
+
+	int32 NumUniqueKeys = 0;
+	for (int32 i = 0; i < OutKeys.Num(); ++i)
+	{
+		if (NumUniqueKeys == 0 || OutKeys[i] != OutKeys[NumUniqueKeys - 1])
+		{
+			OutKeys[NumUniqueKeys++] = OutKeys[i];
+		}
+	}
+
+	OutKeys.SetNum(NumUniqueKeys);
+}
+
+void FMDMetaDataKeyIndex::GatherKeysSupportingProperty(const FProperty* Property, TBitArray<>& OutKeys) const
+{
+	OutKeys.Init(false, NumKeys);
+
+	if (Keys == nullptr || Property == nullptr)
+	{
+		return;
+	}
+
+	const FMDMetaDataEditorPropertyQuery Query(Property);
+	const FProperty* ElementProperty = Query.ElementProperty;
+	if (ElementProperty == nullptr)
+	{
+		return;
+	}
+
+	TestPropertyTypes(WildcardPropertyTypes, Query, OutKeys);
+
+	// Sub-typed categories are looked up by the kind of property since they don't map 1:1 with pin categories (eg. object types also match class properties)
+	if (ElementProperty->IsA<FStructProperty>())
+	{
+		TestPropertyTypesInCategory(UEdGraphSchema_K2::PC_Struct, Query, OutKeys);
+	}
+
+	if (ElementProperty->IsA<FObjectPropertyBase>())
+	{
+		TestPropertyTypesInCategory(UEdGraphSchema_K2::PC_Object, Query, OutKeys);
+	}
+
+	if (ElementProperty->IsA<FSoftObjectProperty>())
+	{
+		TestPropertyTypesInCategory(UEdGraphSchema_K2::PC_SoftObject, Query, OutKeys);
+	}
+
+	if (ElementProperty->IsA<FClassProperty>())
+	{
+		TestPropertyTypesInCategory(UEdGraphSchema_K2::PC_Class, Query, OutKeys);
+	}
+
+	if (ElementProperty->IsA<FSoftClassProperty>())
+	{
+		TestPropertyTypesInCategory(UEdGraphSchema_K2::PC_SoftClass, Query, OutKeys);
+	}
+
+	if (IsValid(Query.Enum))
+	{
+		TestPropertyTypesInCategory(UEdGraphSchema_K2::PC_Enum, Query, OutKeys);
+	}
+
+	if (IsValid(Query.Enum) || (Query.bHasElementPinType && Query.ElementPinType.PinCategory == UEdGraphSchema_K2::PC_Byte))
+	{
+		TestPropertyTypesInCategory(UEdGraphSchema_K2::PC_Byte, Query, OutKeys);
+	}
+
+	if (Query.bHasElementPinType)
+	{
+		if (const TArray<FPropertyTypeEntry>* Entries = PropertyTypesByPinCategory.Find({ Query.ElementPinType.PinCategory, Query.ElementPinType.PinSubCategory }))
+		{
+			TestPropertyTypes(*Entries, Query, OutKeys);
+		}
+	}
+}
+
+void FMDMetaDataKeyIndex::TestPropertyTypes(const TArray<FPropertyTypeEntry>& Entries, const FMDMetaDataEditorPropertyQuery& Query, TBitArray<>& OutKeys) const
+{
+	for (const FPropertyTypeEntry& Entry : Entries)
+	{
+		if (OutKeys[Entry.KeyIndex] || !Keys->IsValidIndex(Entry.KeyIndex))
+		{
+			continue;
+		}
+
+		const TSet<FMDMetaDataEditorPropertyType>& PropertyTypes = (*Keys)[Entry.KeyIndex].SupportedPropertyTypes;
+		if (PropertyTypes.IsValidId(Entry.PropertyTypeId) && PropertyTypes[Entry.PropertyTypeId].DoesMatchQuery(Query))
+		{
+			OutKeys[Entry.KeyIndex] = true;
+		}
+	}
+}
+
+void FMDMetaDataKeyIndex::TestPropertyTypesInCategory(const FName& Category, const FMDMetaDataEditorPropertyQuery& Query, TBitArray<>& OutKeys) const
+{
+	if (const TArray<FPropertyTypeEntry>* Entries = SubTypedPropertyTypes.Find(Category))
+	{
+		TestPropertyTypes(*Entries, Query, OutKeys);
+	}
+}
+
+SIZE_T FMDMetaDataKeyIndex::GetAllocatedSize() const
+{
+	SIZE_T Size = 0;
+	for (const FFieldKindBucket& Bucket : Buckets)
+	{
+		Size += Bucket.KeysBySupportedBlueprint.GetAllocatedSize();
+		for (const TPair<const UClass*, TArray<int32>>& Pair : Bucket.KeysBySupportedBlueprint)
+		{
+			Size += Pair.Value.GetAllocatedSize();
+		}
+
+		Size += Bucket.UnresolvedKeys.GetAllocatedSize();
+		Size += Bucket.AllKeys.GetAllocatedSize();
+
+		Size += Bucket.KeysByBlueprintClass.GetAllocatedSize();
+		for (const TPair<const UClass*, TArray<int32>>& Pair : Bucket.KeysByBlueprintClass)
+		{
+			Size += Pair.Value.GetAllocatedSize();
+		}
+	}
+
+	Size += WildcardPropertyTypes.GetAllocatedSize();
+
+	Size += SubTypedPropertyTypes.GetAllocatedSize();
+	for (const TPair<FName, TArray<FPropertyTypeEntry>>& Pair : SubTypedPropertyTypes)
+	{
+		Size += Pair.Value.GetAllocatedSize();
+	}
+
+	Size += DependencyGraph.GetAllocatedSize();
+
+	Size += CategoryNodes.GetAllocatedSize();
+	for (const FMDMetaDataCategoryNode& Node : CategoryNodes)
+	{
+		Size += Node.Path.GetAllocatedSize();
+	}
+
+	Size += CategoryNodeIdsByGroupName.GetAllocatedSize();
+	Size += KeyCategoryNodeIds.GetAllocatedSize();
+
+	Size += PropertyTypesByPinCategory.GetAllocatedSize();
+	for (const TPair<TPair<FName, FName>, TArray<FPropertyTypeEntry>>& Pair : PropertyTypesByPinCategory)
+	{
+		Size += Pair.Value.GetAllocatedSize();
+	}
+
+	return Size;
+}
@@ -0,0 +1,135 @@
+// Copyright Dylan Dumesnil. All Rights Reserved.
+
+#pragma once
+
+#include "Containers/Array.h"
+#include "Containers/BitArray.h"
+#include "Containers/Map.h"
+#include "Containers/Set.h"
+#include "Internationalization/Text.h"
+#include "Config/MDMetaDataEditorKeyDependencyGraph.h"
+#include "Templates/Function.h"
+
+class FProperty;
+class UBlueprint;
+class UClass;
+struct FMDMetaDataEditorPropertyQuery;
+struct FMDMetaDataEditorPropertyType;
+struct FMDMetaDataKey;
+
+// The kind of field that meta data keys are being gathered for
+enum class EMDMetaDataKeyFieldKind : uint8
+{
+	// Any property, regardless of where it lives (used by struct properties)
+	Property,
+	Variable,
+	LocalVariable,
+	FunctionParameter,
+	Function,
+	Struct,
+
+	Count
+};
+
+// A group in the tree of the keys' pipe-delimited categories, parsed once when the index is built
+struct FMDMetaDataCategoryNode
+{
+	// The last segment of the category, eg. "B" for "A|B"
+	FName Segment;
+	FText DisplayName;
+
+	// The full path, eg. "A|B"
+	FName GroupName;
+	FString Path;
+
+	int32 ParentId = INDEX_NONE;
+};
+
+/**
+ * Buckets meta data keys by the kind of field they can be used on and by the Blueprint classes they support,
+ * so that gathering the keys for a field only visits the keys that can possibly apply to it.
+ * Supported property types are also reverse-mapped by pin category so matching a property is mostly hash lookups.
+ * Stores indices into the key array it was built from and must be rebuilt whenever that array changes.
+ */
+class FMDMetaDataKeyIndex
+{
+public:
+	void Build(const TArray<FMDMetaDataKey>& InKeys);
+	void Reset();
+
+	bool IsBuilt() const { return Keys != nullptr; }
+	bool IsBuiltFor(const TArray<FMDMetaDataKey>& InKeys) const { return Keys == &InKeys && NumKeys == InKeys.Num(); }
+
+	// Unique to each Build, anything holding key indices or dependency graph name ids must be regenerated when this changes
+	uint32 GetBuildSerial() const { return BuildSerial; }
+
+	// Calls Func with the index of each key that can be used on FieldKind in Blueprint, in the order of the source key array
+	void ForEachCandidateKey(EMDMetaDataKeyFieldKind FieldKind, const UBlueprint* Blueprint, const TFunctionRef<void(int32)>& Func) const;
+
+	// Sets the bit of each key index that supports Property, equivalent to calling FMDMetaDataKey::DoesSupportProperty on every key
+	void GatherKeysSupportingProperty(const FProperty* Property, TBitArray<>& OutKeys) const;
+
+	const FMDMetaDataKeyDependencyGraph& GetDependencyGraph() const { return DependencyGraph; }
+
+	// Parents always come before their children, so walking the nodes in order creates groups in a valid order
+	const TArray<FMDMetaDataCategoryNode>& GetCategoryNodes() const { return CategoryNodes; }
+
+	// Returns the id of the innermost category node of a key, or INDEX_NONE if it has no category
+	int32 GetKeyCategoryNodeId(int32 KeyIndex) const { return KeyCategoryNodeIds.IsValidIndex(KeyIndex) ? KeyCategoryNodeIds[KeyIndex] : INDEX_NONE; }
+
+	int32 GetNumKeys() const { return NumKeys; }
+	double GetBuildTimeSeconds() const { return BuildTimeSeconds; }
+	SIZE_T GetAllocatedSize() const;
+
+private:
+	struct FFieldKindBucket
+	{
+		// Keys grouped by each of their resolved SupportedBlueprints classes
+		TMap<const UClass*, TArray<int32>> KeysBySupportedBlueprint;
+
+		// Keys that have a supported Blueprint class that isn't loaded yet, these are checked on every query
+		TArray<int32> UnresolvedKeys;
+
+		// Every key usable on this field kind, for field kinds that don't filter on Blueprint type
+		TArray<int32> AllKeys;
+
+		// Memoized results of ForEachCandidateKey per Blueprint class, filled in as Blueprints are queried
+		mutable TMap<const UClass*, TArray<int32>> KeysByBlueprintClass;
+	};
+
+	int32 AddCategoryNodes(const FString& Category);
+
+	void GatherCandidateKeys(const FFieldKindBucket& Bucket, const UBlueprint* Blueprint, TArray<int32>& OutKeys) const;
+
+	// Refers to the property type by id instead of by pointer so an entry that outlived its key can be detected instead of dangling
+	struct FPropertyTypeEntry
+	{
+		int32 KeyIndex = INDEX_NONE;
+		FSetElementId PropertyTypeId;
+	};
+
+	void TestPropertyTypes(const TArray<FPropertyTypeEntry>& Entries, const FMDMetaDataEditorPropertyQuery& Query, TBitArray<>& OutKeys) const;
+	void TestPropertyTypesInCategory(const FName& Category, const FMDMetaDataEditorPropertyQuery& Query, TBitArray<>& OutKeys) const;
+
+	const TArray<FMDMetaDataKey>* Keys = nullptr;
+	int32 NumKeys = 0;
+	uint32 BuildSerial = 0;
+	double BuildTimeSeconds = 0;
+
+	FMDMetaDataKeyDependencyGraph DependencyGraph;
+
+	TArray<FMDMetaDataCategoryNode> CategoryNodes;
+	TMap<FName, int32> CategoryNodeIdsByGroupName;
+	TArray<int32> KeyCategoryNodeIds;
+
+	FFieldKindBucket Buckets[static_cast<uint8>(EMDMetaDataKeyFieldKind::Count)];
+
+	// Wildcard property types match any property that passes their container check
+	TArray<FPropertyTypeEntry> WildcardPropertyTypes;
+
+	// Struct, object, class, enum and byte property types need more than an exact pin type match (IsChildOf, enum checks, etc.)
+	TMap<FName, TArray<FPropertyTypeEntry>> SubTypedPropertyTypes;
+
+	// All other property types, which only match a property with the same pin category and sub category
+	TMap<TPair<FName, FName>, TArray<FPropertyTypeEntry>> PropertyTypesByPinCategory;
+};
@@ -7,3 +7,15 @@ FText UMDMetaDataEditorUserConfig::GetSectionText() const
 {
 	return INVTEXT("Meta Data Editor (Local Only)");
 }
+
+bool UMDMetaDataEditorUserConfig::IsMetaDataGroupExpanded(const FString& GroupPath, bool bDefaultExpanded) const
+{
+	const bool* bIsExpanded = MetaDataGroupExpansion.Find(GroupPath);
+	return (bIsExpanded != nullptr) ? *bIsExpanded : bDefaultExpanded;
+}
+
+void UMDMetaDataEditorUserConfig::SetMetaDataGroupExpanded(const FString& GroupPath, bool bIsExpanded)
+{
+	MetaDataGroupExpansion.Add(GroupPath, bIsExpanded);
+	SaveConfig();
+}
@@ -17,8 +17,20 @@ class UMDMetaDataEditorUserConfig : public UDeveloperSettings
 public:
 	virtual FText GetSectionText() const override;
 
+	bool IsMetaDataGroupExpanded(const FString& GroupPath, bool bDefaultExpanded) const;
+	void SetMetaDataGroupExpanded(const FString& GroupPath, bool bIsExpanded);
+
 	// If true, a raw key-value editor will be displayed on variables/functions that can have meta data
 	// This viewing/editing of all meta data, even if not exposed by the Meta Data Editor config.
 	UPROPERTY(EditDefaultsOnly, Config, Category = "Editor Config")
 	bool bEnableRawMetaDataEditor = false;
+
+	// If true, editing meta data marks the Blueprint as modified, regenerating its skeleton class and requiring a recompile.
+	// If false, only the meta data on the already compiled classes is updated, which is much faster on large Blueprints.
+	UPROPERTY(EditDefaultsOnly, Config, Category = "Editor Config")
+	bool bMarkBlueprintModifiedOnMetaDataChange = false;
+
+	// The expansion state of the meta data groups the user has opened or closed, keyed by group path (eg. "Inputs|Param Metadata")
+	UPROPERTY(Config)
+	TMap<FString, bool> MetaDataGroupExpansion;
 };
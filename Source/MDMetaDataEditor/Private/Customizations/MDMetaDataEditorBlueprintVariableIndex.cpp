@@ -0,0 +1,215 @@
+// Copyright Dylan Dumesnil. All Rights Reserved.
+
+#include "MDMetaDataEditorBlueprintVariableIndex.h"
+
+#include "Engine/Blueprint.h"
+#include "K2Node_FunctionEntry.h"
+#include "Kismet2/BlueprintEditorUtils.h"
+
+namespace MDMDEBVI_Private
+{
+	FName GetFunctionName(const UK2Node_FunctionEntry* FunctionEntry)
+	{
+		return (FunctionEntry->CustomGeneratedFunctionName != NAME_None) ? FunctionEntry->CustomGeneratedFunctionName : FunctionEntry->GetGraph()->GetFName();
+	}
+}
+
+FMDMetaDataEditorBlueprintVariableIndex& FMDMetaDataEditorBlueprintVariableIndex::Get()
+{
+	static FMDMetaDataEditorBlueprintVariableIndex Instance;
+	return Instance;
+}
+
+FBPVariableDescription* FMDMetaDataEditorBlueprintVariableIndex::FindMemberVariable(UBlueprint* Blueprint, const FName& VarName)
+{
+	if (!IsValid(Blueprint))
+	{
+		return nullptr;
+	}
+
+	FBlueprintVariables& Variables = FindOrBuild(Blueprint);
+	auto FindIndexed = [Blueprint, &Variables, &VarName]() -> FBPVariableDescription*
+	{
+		const int32* Index = Variables.MemberVariables.Find(VarName);
+		return (Index != nullptr && Blueprint->NewVariables.IsValidIndex(*Index) && Blueprint->NewVariables[*Index].VarName == VarName) ? &Blueprint->NewVariables[*Index] : nullptr;
+	};
+
+	if (FBPVariableDescription* Variable = FindIndexed())
+	{
+		return Variable;
+	}
+
+	// A plain miss is only stale if variables were added or removed without a broadcast, otherwise it's not a member variable
+	if (!Variables.MemberVariables.Contains(VarName) && Variables.NumMemberVariables == Blueprint->NewVariables.Num())
+	{
+		return nullptr;
+	}
+
+	Build(Blueprint, Variables);
+	return FindIndexed();
+}
+
+FBPVariableDescription* FMDMetaDataEditorBlueprintVariableIndex::FindLocalVariable(UBlueprint* Blueprint, const UFunction* Function, const FName& VarName, UK2Node_FunctionEntry*& OutFunctionEntry)
+{
+	OutFunctionEntry = FindFunctionEntry(Blueprint, Function);
+	if (OutFunctionEntry == nullptr)
+	{
+		return nullptr;
+	}
+
+	const TPair<FName, FName> LocalKey = { Function->GetFName(), VarName };
+	TArray<FBPVariableDescription>& LocalVariables = OutFunctionEntry->LocalVariables;
+
+	FBlueprintVariables& Variables = FindOrBuild(Blueprint);
+	auto FindIndexed = [&Variables, &LocalVariables, &LocalKey]() -> FBPVariableDescription*
+	{
+		const int32* Index = Variables.LocalVariables.Find(LocalKey);
+		return (Index != nullptr && LocalVariables.IsValidIndex(*Index) && LocalVariables[*Index].VarName == LocalKey.Value) ? &LocalVariables[*Index] : nullptr;
+	};
+
+	if (FBPVariableDescription* Variable = FindIndexed())
+	{
+		return Variable;
+	}
+
+	// Params miss here every time, only rebuild if the function's local variables were added or removed without a broadcast
+	if (!Variables.LocalVariables.Contains(LocalKey) && Variables.NumLocalVariables.FindRef(LocalKey.Key) == LocalVariables.Num())
+	{
+		return nullptr;
+	}
+
+	Build(Blueprint, Variables);
+	return FindIndexed();
+}
+
+UK2Node_FunctionEntry* FMDMetaDataEditorBlueprintVariableIndex::FindFunctionEntry(UBlueprint* Blueprint, const UFunction* Function)
+{
+	if (!IsValid(Blueprint) || !IsValid(Function))
+	{
+		return nullptr;
+	}
+
+	FBlueprintVariables& Variables = FindOrBuild(Blueprint);
+	for (int32 Attempt = 0; Attempt < 2; ++Attempt)
+	{
+		const TWeakObjectPtr<UK2Node_FunctionEntry>* FunctionEntryPtr = Variables.FunctionEntries.Find(Function->GetFName());
+		if (FunctionEntryPtr == nullptr)
+		{
+			return nullptr;
+		}
+
+		UK2Node_FunctionEntry* FunctionEntry = FunctionEntryPtr->Get();
+		if (IsValid(FunctionEntry) && IsValid(FunctionEntry->GetGraph()) && MDMDEBVI_Private::GetFunctionName(FunctionEntry) == Function->GetFName())
+		{
+			// Only match the entry node of this exact function, the same name may belong to the skeleton or generated class
+			return (FFunctionFromNodeHelper::FunctionFromNode(FunctionEntry) == Function) ? FunctionEntry : nullptr;
+		}
+
+		if (Attempt == 0)
+		{
+			Build(Blueprint, Variables);
+		}
+	}
+
+	return nullptr;
+}
+
+void FMDMetaDataEditorBlueprintVariableIndex::Invalidate(UBlueprint* Blueprint)
+{
+	if (FBlueprintVariables* Variables = BlueprintVariables.Find(Blueprint))
+	{
+		Variables->bIsDirty = true;
+	}
+}
+
+void FMDMetaDataEditorBlueprintVariableIndex::Reset()
+{
+	for (const TPair<TObjectKey<UBlueprint>, TWeakObjectPtr<UBlueprint>>& Pair : BoundBlueprints)
+	{
+		if (UBlueprint* Blueprint = Pair.Value.Get())
+		{
+			Blueprint->OnChanged().RemoveAll(this);
+			Blueprint->OnCompiled().RemoveAll(this);
+		}
+	}
+
+	BoundBlueprints.Reset();
+	BlueprintVariables.Reset();
+}
+
+FMDMetaDataEditorBlueprintVariableIndex::FBlueprintVariables& FMDMetaDataEditorBlueprintVariableIndex::FindOrBuild(UBlueprint* Blueprint)
+{
+	// Drop entries for Blueprints that have since been destroyed
+	for (auto It = BoundBlueprints.CreateIterator(); It; ++It)
+	{
+		if (!It.Value().IsValid())
+		{
+			BlueprintVariables.Remove(It.Key());
+			It.RemoveCurrent();
+		}
+	}
+
+	if (!BoundBlueprints.Contains(Blueprint))
+	{
+		Blueprint->OnChanged().AddRaw(this, &FMDMetaDataEditorBlueprintVariableIndex::OnBlueprintChanged);
+		Blueprint->OnCompiled().AddRaw(this, &FMDMetaDataEditorBlueprintVariableIndex::OnBlueprintChanged);
+		BoundBlueprints.Add(Blueprint, Blueprint);
+	}
+
+	FBlueprintVariables& Variables = BlueprintVariables.FindOrAdd(Blueprint);
+	if (Variables.bIsDirty)
+	{
+		Build(Blueprint, Variables);
+	}
+
+	return Variables;
+}
+
+void FMDMetaDataEditorBlueprintVariableIndex::Build(UBlueprint* Blueprint, FBlueprintVariables& Variables)
+{
+	Variables.MemberVariables.Reset();
+	Variables.FunctionEntries.Reset();
+	Variables.LocalVariables.Reset();
+	Variables.NumLocalVariables.Reset();
+	Variables.NumMemberVariables = Blueprint->NewVariables.Num();
+	Variables.bIsDirty = false;
+
+	for (int32 i = 0; i < Blueprint->NewVariables.Num(); ++i)
+	{
+		Variables.MemberVariables.Add(Blueprint->NewVariables[i].VarName, i);
+	}
+
+	for (UEdGraph* Graph : Blueprint->FunctionGraphs)
+	{
+		if (!IsValid(Graph))
+		{
+			continue;
+		}
+
+		for (UEdGraphNode* GraphNode : Graph->Nodes)
+		{
+			UK2Node_FunctionEntry* FunctionEntry = Cast<UK2Node_FunctionEntry>(GraphNode);
+			if (!IsValid(FunctionEntry))
+			{
+				continue;
+			}
+
+			const FName FunctionName = MDMDEBVI_Private::GetFunctionName(FunctionEntry);
+			Variables.FunctionEntries.Add(FunctionName, FunctionEntry);
+			Variables.NumLocalVariables.Add(FunctionName, FunctionEntry->LocalVariables.Num());
+
+			for (int32 i = 0; i < FunctionEntry->LocalVariables.Num(); ++i)
+			{
+				Variables.LocalVariables.Add({ FunctionName, FunctionEntry->LocalVariables[i].VarName }, i);
+			}
+
+			// Only the first entry node of each graph is used, matching how the entry node is found elsewhere
+			break;
+		}
+	}
+}
+
+void FMDMetaDataEditorBlueprintVariableIndex::OnBlueprintChanged(UBlueprint* Blueprint)
+{
+	Invalidate(Blueprint);
+}
@@ -0,0 +1,53 @@
+// Copyright Dylan Dumesnil. All Rights Reserved.
+
+#pragma once
+
+#include "Containers/Map.h"
+#include "UObject/ObjectKey.h"
+#include "UObject/WeakObjectPtrTemplates.h"
+
+class UBlueprint;
+class UFunction;
+class UK2Node_FunctionEntry;
+struct FBPVariableDescription;
+
+/**
+ * Maps variable names to their FBPVariableDescription, for member variables and function local variables, so that editing the meta data
+ * of a variable doesn't need to scan every variable in the Blueprint. Entries are validated on use and the index for a Blueprint is
+ * rebuilt when it broadcasts a change (structural changes, variable renames) or is compiled, or when a lookup finds it stale.
+ */
+class FMDMetaDataEditorBlueprintVariableIndex
+{
+public:
+	static FMDMetaDataEditorBlueprintVariableIndex& Get();
+
+	FBPVariableDescription* FindMemberVariable(UBlueprint* Blueprint, const FName& VarName);
+
+	// Finds the entry node of Function in Blueprint, and the local variable named VarName within it
+	FBPVariableDescription* FindLocalVariable(UBlueprint* Blueprint, const UFunction* Function, const FName& VarName, UK2Node_FunctionEntry*& OutFunctionEntry);
+
+	UK2Node_FunctionEntry* FindFunctionEntry(UBlueprint* Blueprint, const UFunction* Function);
+
+	void Invalidate(UBlueprint* Blueprint);
+	void Reset();
+
+private:
+	struct FBlueprintVariables
+	{
+		TMap<FName, int32> MemberVariables;
+		TMap<FName, TWeakObjectPtr<UK2Node_FunctionEntry>> FunctionEntries;
+		TMap<TPair<FName, FName>, int32> LocalVariables;
+		// The variable counts at the last build, a miss only rebuilds when they no longer match
+		TMap<FName, int32> NumLocalVariables;
+		int32 NumMemberVariables = 0;
+		bool bIsDirty = true;
+	};
+
+	FBlueprintVariables& FindOrBuild(UBlueprint* Blueprint);
+	static void Build(UBlueprint* Blueprint, FBlueprintVariables& Variables);
+
+	void OnBlueprintChanged(UBlueprint* Blueprint);
+
+	TMap<TObjectKey<UBlueprint>, FBlueprintVariables> BlueprintVariables;
+	TMap<TObjectKey<UBlueprint>, TWeakObjectPtr<UBlueprint>> BoundBlueprints;
+};
@@ -15,6 +15,7 @@
 #include "K2Node_FunctionResult.h"
 #include "K2Node_Tunnel.h"
 #include "Kismet2/BlueprintEditorUtils.h"
+#include "MDMetaDataEditorStats.h"
 #include "ScopedTransaction.h"
 #include "Widgets/Input/SButton.h"
 #include "Widgets/Input/SCheckBox.h"
@@ -47,6 +48,8 @@ void FMDMetaDataEditorCustomizationBase::RefreshDetails()
 {
 	if (DetailBuilderPtr != nullptr)
 	{
+		MDMDE_SCOPE_CYCLE_COUNTER(STAT_MDMetaDataEditor_RefreshDetails);
+
 		DetailBuilderPtr->ForceRefreshDetails();
 		DetailBuilderPtr = nullptr;
 	}
@@ -5,16 +5,24 @@
 #include "BlueprintActionDatabase.h"
 #include "Config/MDMetaDataEditorConfig.h"
 #include "Config/MDMetaDataEditorUserConfig.h"
+#include "Containers/Ticker.h"
+#include "Customizations/MDMetaDataEditorBlueprintVariableIndex.h"
 #include "Customizations/MDMetaDataEditorCustomizationBase.h"
+#include "Customizations/MDMetaDataEditorFieldViewNodeBuilder.h"
+#include "CoreGlobals.h"
 #include "DetailLayoutBuilder.h"
 #include "DetailWidgetRow.h"
 #include "Engine/UserDefinedStruct.h"
 #include "HAL/PlatformApplicationMisc.h"
+#include "HAL/PlatformTime.h"
+#include "IDetailChildrenBuilder.h"
 #include "IDetailGroup.h"
 #include "K2Node_CustomEvent.h"
 #include "K2Node_FunctionEntry.h"
 #include "K2Node_Tunnel.h"
 #include "Kismet2/BlueprintEditorUtils.h"
+#include "MDMetaDataEditorModule.h"
+#include "MDMetaDataEditorStats.h"
 #include "ScopedTransaction.h"
 #include "SlateOptMacros.h"
 #include "Styling/AppStyle.h"
@@ -25,7 +33,10 @@
 #include "Widgets/Input/SCheckBox.h"
 #include "Widgets/Input/SEditableTextBox.h"
 #include "Widgets/Input/SNumericEntryBox.h"
+#include "Widgets/SMDMetaDataDeferredWidget.h"
 #include "Widgets/SMDMetaDataGameplayTagPicker.h"
+#include "Widgets/SMDMetaDataGroupHeader.h"
+#include "Widgets/SMDMetaDataRawEditor.h"
 #include "Widgets/SMDMetaDataStringComboBox.h"
 #include "Widgets/Text/STextBlock.h"
 
@@ -35,53 +46,66 @@
 
 namespace MDMDEFV_Private
 {
-	template<typename T, bool bExact>
-	T* FindNode(UObject* Object)
+	struct FParsedClipboard
 	{
-		if (T* Node = Cast<T>(Object))
+		// Set if the clipboard is in the Key=Value format used in C++
+		TOptional<FName> Key;
+		FString Value;
+		bool bIsValid = false;
+
+		bool CanPasteTo(const FName& InKey) const
 		{
-			return Node;
+			return bIsValid && (!Key.IsSet() || Key.GetValue() == InKey);
 		}
-		if (UEdGraph* Graph = Cast<UEdGraph>(Object))
-		{
-			for (UEdGraphNode* GraphNode : Graph->Nodes)
-			{
-				if constexpr (bExact)
-				{
-					if (T* Node = ExactCast<T>(GraphNode))
-					{
-						return Node;
-					}
-				}
-				else
-				{
-					if (T* Node = Cast<T>(GraphNode))
-					{
-						return Node;
-					}
-				}
-			}
-		}
-		return nullptr;
+	};
+
+	// Reading the clipboard can be slow depending on the platform and every metadata row checks it when building its context menu,
+	// so it's read and parsed at most once per frame and shared between all field views
+	FParsedClipboard ParsedClipboard;
+	uint64 ParsedFrame = MAX_uint64;
+
+	void InvalidateParsedClipboard()
+	{
+		ParsedFrame = MAX_uint64;
 	}
 
-	UK2Node_FunctionEntry* FindFunctionNode(const UBlueprint* Blueprint, const UFunction* Function)
+	const FParsedClipboard& GetParsedClipboard()
 	{
-		if (!IsValid(Blueprint) || !IsValid(Function))
+		if (ParsedFrame == GFrameCounter)
 		{
-			return nullptr;
+			return ParsedClipboard;
 		}
 
-		for (UEdGraph* Graph : Blueprint->FunctionGraphs)
+		ParsedFrame = GFrameCounter;
+		ParsedClipboard = FParsedClipboard();
+
+		FString Clipboard;
+		FPlatformApplicationMisc::ClipboardPaste(Clipboard);
+		Clipboard.TrimStartAndEndInline();
+
+		// Handle pasting the same metadata format used in C++
+		int32 EqualIndex = INDEX_NONE;
+		if (Clipboard.FindChar(TEXT('='), EqualIndex) && EqualIndex > 0)
 		{
-			UK2Node_FunctionEntry* FunctionEntry = FindNode<UK2Node_FunctionEntry, false>(Graph);
-			if (IsValid(FunctionEntry) && FFunctionFromNodeHelper::FunctionFromNode(FunctionEntry) == Function)
+			// Skip if the clipboard has != or == without starting with "Key=" (like a raw edit condition) but ending with = means a blank value
+			if (Clipboard[EqualIndex - 1] != TEXT('!') && (EqualIndex == (Clipboard.Len() - 1) || Clipboard[EqualIndex + 1] != TEXT('=')))
 			{
-				return FunctionEntry;
+				ParsedClipboard.Key = FName(Clipboard.Left(EqualIndex).TrimStartAndEnd());
+				ParsedClipboard.Value = Clipboard.Mid(EqualIndex + 1).TrimStartAndEnd().TrimQuotes().ReplaceEscapedCharWithChar();
+				ParsedClipboard.bIsValid = true;
+				return ParsedClipboard;
 			}
 		}
 
-		return nullptr;
+		// Clipboard is just the value
+		if (!Clipboard.IsEmpty())
+		{
+			Clipboard.TrimQuotesInline();
+			ParsedClipboard.Value = Clipboard.ReplaceEscapedCharWithChar();
+			ParsedClipboard.bIsValid = true;
+		}
+
+		return ParsedClipboard;
 	}
 }
 
@@ -227,17 +251,17 @@ FKismetUserDeclaredFunctionMetadata* FMDMetaDataEditorFieldView::GetFunctionMeta
 {
 	if (UK2Node_FunctionEntry* FuncNode = MetadataFunctionEntry.Get())
 	{
-		FuncNode->Modify();
+		ModifyOnce(FuncNode);
 		return &(FuncNode->MetaData);
 	}
 	else if (UK2Node_Tunnel* TunnelNode = MetadataTunnel.Get())
 	{
-		TunnelNode->Modify();
+		ModifyOnce(TunnelNode);
 		return &(TunnelNode->MetaData);
 	}
 	else if (UK2Node_CustomEvent* EventNode = MetadataCustomEvent.Get())
 	{
-		EventNode->Modify();
+		ModifyOnce(EventNode);
 		return &(EventNode->GetUserDefinedMetaData());
 	}
 
@@ -251,11 +275,41 @@ void FMDMetaDataEditorFieldView::GenerateMetadataEditor(IDetailLayoutBuilder& De
 		return;
 	}
 
+	MDMDE_SCOPE_CYCLE_COUNTER(STAT_MDMetaDataEditor_GenerateMetadataEditor);
+
 	FMDMetadataBuilderRow BuilderRow = InitCategories(DetailLayout, GroupMap);
+	if (BuilderRow.HasSubtype<IDetailCategoryBuilder*>())
+	{
+		// This view owns the whole category, so its rows go through a node builder that can rebuild them without refreshing the details panel
+		const TSharedRef<FMDMetaDataEditorFieldViewNodeBuilder> Builder = MakeShared<FMDMetaDataEditorFieldViewNodeBuilder>(AsShared());
+		BuilderRow.GetSubtype<IDetailCategoryBuilder*>()->AddCustomBuilder(Builder);
+		NodeBuilder = Builder;
+		return;
+	}
+
+	NodeBuilder.Reset();
+	GenerateMetadataRows(BuilderRow);
+}
+
+void FMDMetaDataEditorFieldView::GenerateMetadataRows(FMDMetadataBuilderRow BuilderRow)
+{
+	DependentRows.Reset();
+	DependentRowsByKey.Reset();
+	RowsSerial = 0;
 
-	auto AddMetaDataKey = [this, &GroupMap, &BuilderRow](const FMDMetaDataKey& Key)
+	// Category groups are created on demand as keys reach them, every view creates its own under its builder row
+	CategoryGroups.Reset();
+	CategoryGroups.SetNum(GetDefault<UMDMetaDataEditorConfig>()->GetKeyIndex().GetCategoryNodes().Num());
+
+	// Resolve the visibility of every key up front in a single pass, rows then only need to look up their bit
+	UpdateMetadataSnapshot();
+	const FMDMetaDataKeyIndex& Index = GetDefault<UMDMetaDataEditorConfig>()->GetKeyIndex();
+	Index.GetDependencyGraph().GatherVisibleKeys(PresentKeys, VisibleKeys);
+	RowsSerial = Index.GetBuildSerial();
+
+	auto AddMetaDataKey = [this, &BuilderRow](int32 KeyIndex, const FMDMetaDataKey& Key)
 	{
-		AddMetadataValueEditor(Key, BuilderRow, GroupMap);
+		AddMetadataValueEditor(KeyIndex, Key, BuilderRow);
 	};
 
 	AddMetadataValueEditor(AddMetaDataKey);
@@ -268,14 +322,20 @@ void FMDMetaDataEditorFieldView::GenerateMetadataEditor(IDetailLayoutBuilder& De
 	}
 }
 
-TUnion<IDetailCategoryBuilder*, IDetailGroup*> FMDMetaDataEditorFieldView::InitCategories(IDetailLayoutBuilder& DetailLayout, TMap<FName, IDetailGroup*>& GroupMap)
+FMDMetaDataEditorFieldView::FMDMetadataBuilderRow FMDMetaDataEditorFieldView::InitCategories(IDetailLayoutBuilder& DetailLayout, TMap<FName, IDetailGroup*>& GroupMap)
 {
 	FMDMetadataBuilderRow Result;
+	ExpansionPathRoot.Reset();
+	bIsBuilderRowExpanded = true;
+
+	const UMDMetaDataEditorUserConfig* UserConfig = GetDefault<UMDMetaDataEditorUserConfig>();
 
 	switch (FieldType) {
 	case EMDMetaDataEditorFieldType::Variable:
 	case EMDMetaDataEditorFieldType::LocalVariable:
 	{
+		ExpansionPathRoot = TEXT("Metadata");
+
 		// Put Metadata above Default Value for Variables
 		int32 MetadataSortOrder = DetailLayout.EditCategory("Variable").GetSortOrder();
 		IDetailCategoryBuilder& MetadataCategory = DetailLayout.EditCategory("Metadata");
@@ -297,12 +357,18 @@ TUnion<IDetailCategoryBuilder*, IDetailGroup*> FMDMetaDataEditorFieldView::InitC
 			const FName GroupName =  (FieldType == EMDMetaDataEditorFieldType::FunctionParamInput)
 				? TEXT("Input Param Metadata")
 				: TEXT("Output Param Metadata");
+			const FString ParamGroupPath = CategoryName.ToString() + TEXT("|Param Metadata");
 			IDetailGroup*& ParamGroup = GroupMap.FindOrAdd(GroupName);
 			if (ParamGroup == nullptr)
 			{
-				ParamGroup = &Category.AddGroup(TEXT("Param Metadata"), INVTEXT("Param Metadata"));
+				ParamGroup = &AddMetadataGroup(FMDMetadataBuilderRow(&Category), TEXT("Param Metadata"), INVTEXT("Param Metadata"), ParamGroupPath, false);
 			}
-			IDetailGroup& Group = ParamGroup->AddGroup(MetadataProperty->GetFName(), MetadataProperty->GetDisplayNameText());
+
+			// Keyed by function and param name, param names alone repeat across functions (eg. Target)
+			const UObject* Owner = MetadataProperty->GetOwnerUObject();
+			ExpansionPathRoot = FString::Printf(TEXT("%s|%s|%s"), *ParamGroupPath, *GetNameSafe(Owner), *MetadataProperty->GetName());
+			IDetailGroup& Group = AddMetadataGroup(FMDMetadataBuilderRow(ParamGroup), MetadataProperty->GetFName(), MetadataProperty->GetDisplayNameText(), ExpansionPathRoot, false);
+			bIsBuilderRowExpanded = UserConfig->IsMetaDataGroupExpanded(ParamGroupPath, false) && UserConfig->IsMetaDataGroupExpanded(ExpansionPathRoot, false);
 			Result.SetSubtype<IDetailGroup*>(&Group);
 		}
 		break;
@@ -311,12 +377,15 @@ TUnion<IDetailCategoryBuilder*, IDetailGroup*> FMDMetaDataEditorFieldView::InitC
 	{
 		if (MetadataProperty.IsValid())
 		{
+			// User struct property names are unique per property, so each one remembers its own expansion state
+			ExpansionPathRoot = FString::Printf(TEXT("Property Metadata|%s"), *MetadataProperty->GetName());
 			IDetailGroup*& Group = GroupMap.FindOrAdd(MetadataProperty->GetFName());
 			if (Group == nullptr)
 			{
-				Group = &DetailLayout.EditCategory("Property Metadata").AddGroup(MetadataProperty->GetFName(), MetadataProperty->GetDisplayNameText());
+				Group = &AddMetadataGroup(FMDMetadataBuilderRow(&DetailLayout.EditCategory("Property Metadata")), MetadataProperty->GetFName(), MetadataProperty->GetDisplayNameText(), ExpansionPathRoot, false);
 			}
 
+			bIsBuilderRowExpanded = UserConfig->IsMetaDataGroupExpanded(ExpansionPathRoot, false);
 			Result.SetSubtype<IDetailGroup*>(Group);
 		}
 		break;
@@ -325,6 +394,8 @@ TUnion<IDetailCategoryBuilder*, IDetailGroup*> FMDMetaDataEditorFieldView::InitC
 	case EMDMetaDataEditorFieldType::Tunnel:
 	case EMDMetaDataEditorFieldType::CustomEvent:
 	{
+		ExpansionPathRoot = TEXT("Metadata");
+
 		int32 MetadataSortOrder = DetailLayout.EditCategory("Graph").GetSortOrder();
 		IDetailCategoryBuilder& MetadataCategory = DetailLayout.EditCategory("Metadata");
 		MetadataCategory.SetSortOrder(++MetadataSortOrder);
@@ -335,6 +406,8 @@ TUnion<IDetailCategoryBuilder*, IDetailGroup*> FMDMetaDataEditorFieldView::InitC
 	}
 	case EMDMetaDataEditorFieldType::Struct:
 	{
+		ExpansionPathRoot = TEXT("Struct Metadata");
+
 		IDetailCategoryBuilder& MetadataCategory = DetailLayout.EditCategory("Struct Metadata");
 		int32 MetadataSortOrder = MetadataCategory.GetSortOrder();
 		DetailLayout.EditCategory("Property Metadata").SetSortOrder(++MetadataSortOrder);
@@ -346,7 +419,74 @@ TUnion<IDetailCategoryBuilder*, IDetailGroup*> FMDMetaDataEditorFieldView::InitC
 	return Result;
 }
 
-void FMDMetaDataEditorFieldView::AddMetadataValueEditor(const TFunctionRef<void(const FMDMetaDataKey&)>& Func)
+IDetailGroup& FMDMetaDataEditorFieldView::AddMetadataGroup(FMDMetadataBuilderRow Parent, FName GroupName, const FText& DisplayName, const FString& ExpansionPath, bool bDefaultExpanded)
+{
+	const bool bIsExpanded = GetDefault<UMDMetaDataEditorUserConfig>()->IsMetaDataGroupExpanded(ExpansionPath, bDefaultExpanded);
+
+	IDetailGroup& Group = Parent.HasSubtype<IDetailGroup*>() ? Parent.GetSubtype<IDetailGroup*>()->AddGroup(GroupName, DisplayName, bIsExpanded)
+		: Parent.HasSubtype<IDetailChildrenBuilder*>() ? Parent.GetSubtype<IDetailChildrenBuilder*>()->AddGroup(GroupName, DisplayName, bIsExpanded)
+		: Parent.GetSubtype<IDetailCategoryBuilder*>()->AddGroup(GroupName, DisplayName, false, bIsExpanded);
+
+	Group.HeaderRow()
+		.FilterString(DisplayName)
+		.NameContent()
+		[
+			SNew(SMDMetaDataGroupHeader, Group)
+			.DisplayName(DisplayName)
+			.ExpansionPath(ExpansionPath)
+			.IsExpanded(bIsExpanded)
+		];
+
+	return Group;
+}
+
+FDetailWidgetRow& FMDMetaDataEditorFieldView::AddMetadataRow(FMDMetadataBuilderRow Parent, const FText& FilterText)
+{
+	if (Parent.HasSubtype<IDetailGroup*>())
+	{
+		return Parent.GetSubtype<IDetailGroup*>()->AddWidgetRow().FilterString(FilterText);
+	}
+	else if (Parent.HasSubtype<IDetailChildrenBuilder*>())
+	{
+		return Parent.GetSubtype<IDetailChildrenBuilder*>()->AddCustomRow(FilterText);
+	}
+
+	return Parent.GetSubtype<IDetailCategoryBuilder*>()->AddCustomRow(FilterText);
+}
+
+bool FMDMetaDataEditorFieldView::IsBuilderRowValid(const FMDMetadataBuilderRow& BuilderRow)
+{
+	return (BuilderRow.HasSubtype<IDetailCategoryBuilder*>() && BuilderRow.GetSubtype<IDetailCategoryBuilder*>() != nullptr)
+		|| (BuilderRow.HasSubtype<IDetailGroup*>() && BuilderRow.GetSubtype<IDetailGroup*>() != nullptr)
+		|| (BuilderRow.HasSubtype<IDetailChildrenBuilder*>() && BuilderRow.GetSubtype<IDetailChildrenBuilder*>() != nullptr);
+}
+
+const FMDMetaDataEditorFieldView::FCategoryGroup& FMDMetaDataEditorFieldView::FindOrAddCategoryGroup(int32 NodeId, FMDMetadataBuilderRow BuilderRow)
+{
+	if (CategoryGroups[NodeId].Group != nullptr)
+	{
+		return CategoryGroups[NodeId];
+	}
+
+	const FMDMetaDataCategoryNode& Node = GetDefault<UMDMetaDataEditorConfig>()->GetKeyIndex().GetCategoryNodes()[NodeId];
+
+	bool bIsParentExpanded = bIsBuilderRowExpanded;
+	if (CategoryGroups.IsValidIndex(Node.ParentId))
+	{
+		const FCategoryGroup& ParentGroup = FindOrAddCategoryGroup(Node.ParentId, BuilderRow);
+		BuilderRow = FMDMetadataBuilderRow(ParentGroup.Group);
+		bIsParentExpanded = ParentGroup.bIsExpanded;
+	}
+
+	const FString ExpansionPath = FString::Printf(TEXT("%s|%s"), *ExpansionPathRoot, *Node.Path);
+
+	FCategoryGroup& CategoryGroup = CategoryGroups[NodeId];
+	CategoryGroup.Group = &AddMetadataGroup(BuilderRow, Node.GroupName, Node.DisplayName, ExpansionPath, true);
+	CategoryGroup.bIsExpanded = bIsParentExpanded && GetDefault<UMDMetaDataEditorUserConfig>()->IsMetaDataGroupExpanded(ExpansionPath, true);
+	return CategoryGroup;
+}
+
+void FMDMetaDataEditorFieldView::AddMetadataValueEditor(const TFunctionRef<void(int32, const FMDMetaDataKey&)>& Func)
 {
 	const UMDMetaDataEditorConfig* Config = GetDefault<UMDMetaDataEditorConfig>();
 	switch (FieldType) {
@@ -376,62 +516,37 @@ void FMDMetaDataEditorFieldView::AddMetadataValueEditor(const TFunctionRef<void(
 
 BEGIN_SLATE_FUNCTION_BUILD_OPTIMIZATION
 
-void FMDMetaDataEditorFieldView::AddMetadataValueEditor(const FMDMetaDataKey& Key, FMDMetadataBuilderRow BuilderRow, TMap<FName, IDetailGroup*>& GroupMap)
+void FMDMetaDataEditorFieldView::AddMetadataValueEditor(int32 KeyIndex, const FMDMetaDataKey& Key, FMDMetadataBuilderRow BuilderRow)
 {
-	if (Key.RequiredMetaData != Key.Key && !Key.RequiredMetaData.IsNone() && !HasMetadataValue(Key.RequiredMetaData))
+	MDMDE_SCOPE_CYCLE_COUNTER(STAT_MDMetaDataEditor_AddMetadataValueEditor);
+
+	if (!IsBuilderRowValid(BuilderRow))
 	{
 		return;
 	}
 
-	for (const FName& IncompatibleKey : Key.IncompatibleMetaData)
-	{
-		if (IncompatibleKey != Key.Key && !IncompatibleKey.IsNone() && HasMetadataValue(IncompatibleKey))
-		{
-			return;
-		}
-	}
+	// Rows that depend on other keys are always built and hide themselves, so setting or removing a key doesn't require a rebuild
+	const int32 DependentRowIndex = AddDependentRow(KeyIndex, Key);
+	const bool bIsRowHidden = DependentRows.IsValidIndex(DependentRowIndex) && DependentRows[DependentRowIndex].Visibility != EVisibility::Visible;
 
-	IDetailCategoryBuilder* Category = BuilderRow.HasSubtype<IDetailCategoryBuilder*>() ? BuilderRow.GetSubtype<IDetailCategoryBuilder*>() : nullptr;
-	IDetailGroup* Group = BuilderRow.HasSubtype<IDetailGroup*>() ? BuilderRow.GetSubtype<IDetailGroup*>() : nullptr;
+	bool bIsRowExpanded = bIsBuilderRowExpanded;
 
-	FName GroupName = MetadataProperty.IsValid() ? MetadataProperty->GetFName() : NAME_None;
-	TArray<FString> Subgroups;
-	Key.Category.ParseIntoArray(Subgroups, TEXT("|"));
-	for (const FString& Subgroup : Subgroups)
+	const int32 CategoryNodeId = GetDefault<UMDMetaDataEditorConfig>()->GetKeyIndex().GetKeyCategoryNodeId(KeyIndex);
+	if (CategoryGroups.IsValidIndex(CategoryNodeId))
 	{
-		const FText DisplayName = FText::FromString(Subgroup);
-		if (DisplayName.IsEmptyOrWhitespace())
-		{
-			continue;
-		}
-
-		GroupName = (GroupName.IsNone()) ? *Subgroup : *FString::Printf(TEXT("%s|%s"), *GroupName.ToString(), *Subgroup);
-
-		if (GroupMap.Contains(GroupName))
-		{
-			Group = GroupMap.FindRef(GroupName);
-		}
-		else if (Group != nullptr)
-		{
-			Group = &Group->AddGroup(GroupName, DisplayName, true);
-			GroupMap.Add(GroupName, Group);
-		}
-		else if (Category != nullptr)
-		{
-			Group = &Category->AddGroup(GroupName, DisplayName, false, true);
-			GroupMap.Add(GroupName, Group);
-		}
+		const FCategoryGroup& CategoryGroup = FindOrAddCategoryGroup(CategoryNodeId, BuilderRow);
+		BuilderRow = FMDMetadataBuilderRow(CategoryGroup.Group);
+		bIsRowExpanded = CategoryGroup.bIsExpanded;
 	}
 
-	if (Group == nullptr && Category == nullptr)
+	FDetailWidgetRow& MetaDataRow = AddMetadataRow(BuilderRow, Key.GetFilterText());
+	MDMDE_INC_COUNTER(MDMetaDataEditor_RowsBuilt, 1);
+
+	if (DependentRowIndex != INDEX_NONE)
 	{
-		return;
+		MetaDataRow.Visibility(TAttribute<EVisibility>::CreateSP(this, &FMDMetaDataEditorFieldView::GetDependentRowVisibility, DependentRowIndex));
 	}
 
-	FDetailWidgetRow& MetaDataRow = (Group != nullptr)
-		? Group->AddWidgetRow().FilterString(Key.GetFilterText())
-		: Category->AddCustomRow(Key.GetFilterText());
-
 	const FUIAction CopyAction = {
 		FExecuteAction::CreateSP(this, &FMDMetaDataEditorFieldView::CopyMetadata, Key.Key),
 		FCanExecuteAction::CreateSP(this, &FMDMetaDataEditorFieldView::CanCopyMetadata, Key.Key)
@@ -455,7 +570,9 @@ void FMDMetaDataEditorFieldView::AddMetadataValueEditor(const FMDMetaDataKey& Ke
 		]
 		.ValueContent()
 		[
-			CreateMetaDataValueWidget(Key)
+			(bIsRowExpanded && !bIsRowHidden)
+				? CreateMetaDataValueWidget(Key)
+				: SNew(SMDMetaDataDeferredWidget).OnGenerateContent(this, &FMDMetaDataEditorFieldView::CreateMetaDataValueWidget, Key)
 		]
 		.ExtensionContent()
 		[
@@ -478,59 +595,35 @@ END_SLATE_FUNCTION_BUILD_OPTIMIZATION
 
 void FMDMetaDataEditorFieldView::AddRawMetadataEditor(FMDMetadataBuilderRow BuilderRow)
 {
-	IDetailCategoryBuilder* Category = BuilderRow.HasSubtype<IDetailCategoryBuilder*>() ? BuilderRow.GetSubtype<IDetailCategoryBuilder*>() : nullptr;
-	IDetailGroup* Group = BuilderRow.HasSubtype<IDetailGroup*>() ? BuilderRow.GetSubtype<IDetailGroup*>() : nullptr;
-
-	if (Category == nullptr && Group == nullptr)
+	if (!IsBuilderRowValid(BuilderRow))
 	{
 		return;
 	}
 
-	IDetailGroup& DetailGroup = (Group != nullptr)
-		? Group->AddGroup(TEXT("RawMetadata"), INVTEXT("Raw Metadata"))
-		: Category->AddGroup(TEXT("RawMetadata"), INVTEXT("Raw Metadata"));
+	MDMDE_SCOPE_CYCLE_COUNTER(STAT_MDMetaDataEditor_AddRawMetadataEditor);
 
-	if (const TMap<FName, FString>* MetadataMap = GetMetadataMap())
+	const FString ExpansionPath = ExpansionPathRoot + TEXT("|Raw Metadata");
+	const bool bIsRawExpanded = bIsBuilderRowExpanded && GetDefault<UMDMetaDataEditorUserConfig>()->IsMetaDataGroupExpanded(ExpansionPath, false);
+	IDetailGroup& DetailGroup = AddMetadataGroup(BuilderRow, TEXT("RawMetadata"), INVTEXT("Raw Metadata"), ExpansionPath, false);
+
+	// A single virtualized list instead of a details row per entry, since some variables carry a lot of raw meta data
+	if (const TMap<FName, FString>* MetadataMap = GetMetadataMap(); MetadataMap != nullptr && !MetadataMap->IsEmpty())
 	{
+		TStringBuilder<1024> FilterString;
 		for (const TPair<FName, FString>& MetaDataPair : *MetadataMap)
 		{
-			DetailGroup.AddWidgetRow()
-				.FilterString(FText::Format(INVTEXT("{0}={1}"), FText::FromName(MetaDataPair.Key), FText::FromString(MetaDataPair.Value)))
-				.IsEnabled(!bIsReadOnly)
-				.NameContent()
-				.HAlign(HAlign_Fill)
-				[
-					SNew(SEditableTextBox)
-					.Text(FText::FromName(MetaDataPair.Key))
-					.OnTextCommitted(this, &FMDMetaDataEditorFieldView::OnMetadataKeyTextCommitted, MetaDataPair.Key)
-					.RevertTextOnEscape(true)
-				]
-				.ValueContent()
-				.HAlign(HAlign_Fill)
-				[
-					SNew(SEditableTextBox)
-					.Text(this, &FMDMetaDataEditorFieldView::GetMetadataValueText, MetaDataPair.Key)
-					.ToolTipText(this, &FMDMetaDataEditorFieldView::GetMetadataValueText, MetaDataPair.Key)
-					.OnTextCommitted(this, &FMDMetaDataEditorFieldView::OnMetadataValueTextCommittedAllowingEmpty, MetaDataPair.Key)
-					.RevertTextOnEscape(true)
-				]
-				.ExtensionContent()
-				[
-					SNew(SButton)
-					.IsFocusable(false)
-					.ToolTipText(INVTEXT("Remove this meta data"))
-					.ButtonStyle(FAppStyle::Get(), "SimpleButton")
-					.ContentPadding(0)
-					.Visibility(this, &FMDMetaDataEditorFieldView::GetRemoveMetadataButtonVisibility, MetaDataPair.Key)
-					.OnClicked(this, &FMDMetaDataEditorFieldView::OnRemoveMetadata, MetaDataPair.Key)
-					.Content()
-					[
-						SNew(SImage)
-						.Image(FAppStyle::GetBrush("Icons.X"))
-						.ColorAndOpacity(FSlateColor::UseForeground())
-					]
-				];
+			FilterString << MetaDataPair.Key << TEXT('=') << MetaDataPair.Value << TEXT(' ');
 		}
+
+		MDMDE_INC_COUNTER(MDMetaDataEditor_RowsBuilt, 1);
+		DetailGroup.AddWidgetRow()
+			.FilterString(FText::FromString(FString(FilterString.ToView())))
+			.WholeRowContent()
+			[
+				bIsRawExpanded
+					? CreateRawMetadataListWidget()
+					: SNew(SMDMetaDataDeferredWidget).OnGenerateContent(this, &FMDMetaDataEditorFieldView::CreateRawMetadataListWidget)
+			];
 	}
 
 	// Add meta data row
@@ -558,6 +651,34 @@ void FMDMetaDataEditorFieldView::AddRawMetadataEditor(FMDMetadataBuilderRow Buil
 	}
 }
 
+SIZE_T FMDMetaDataEditorFieldView::GetAllocatedSize() const
+{
+	SIZE_T Size = MetadataSnapshot.GetAllocatedSize();
+	for (const TPair<FName, FMetadataSnapshotEntry>& Pair : MetadataSnapshot)
+	{
+		Size += Pair.Value.Value.GetAllocatedSize();
+	}
+
+	Size += DependentRows.GetAllocatedSize();
+	Size += DependentRowsByKey.GetAllocatedSize();
+	Size += PresentKeys.GetAllocatedSize();
+	Size += VisibleKeys.GetAllocatedSize();
+	Size += CategoryGroups.GetAllocatedSize();
+	Size += BatchModifiedObjects.GetAllocatedSize();
+
+	return Size;
+}
+
+TSharedRef<SWidget> FMDMetaDataEditorFieldView::CreateRawMetadataListWidget()
+{
+	return SNew(SMDMetaDataRawEditor)
+		.IsReadOnly(bIsReadOnly)
+		.OnGetMetaDataMap(this, &FMDMetaDataEditorFieldView::GetMetadataMap)
+		.OnKeyCommitted(this, &FMDMetaDataEditorFieldView::OnMetadataKeyTextCommitted)
+		.OnValueCommitted(this, &FMDMetaDataEditorFieldView::OnMetadataValueTextCommittedAllowingEmpty)
+		.OnRemoveMetaData(this, &FMDMetaDataEditorFieldView::OnRemoveMetadata);
+}
+
 bool FMDMetaDataEditorFieldView::IsConfigEnabled() const
 {
 	const UMDMetaDataEditorConfig* Config = GetDefault<UMDMetaDataEditorConfig>();
@@ -698,7 +819,7 @@ TSharedRef<SWidget> FMDMetaDataEditorFieldView::CreateMetaDataValueWidget(const
 
 EVisibility FMDMetaDataEditorFieldView::GetRemoveMetadataButtonVisibility(FName Key) const
 {
-	return HasMetadataValue(Key) ? EVisibility::Visible : EVisibility::Collapsed;
+	return (FindMetadataSnapshotEntry(Key) != nullptr) ? EVisibility::Visible : EVisibility::Collapsed;
 }
 
 FReply FMDMetaDataEditorFieldView::OnRemoveMetadata(FName Key)
@@ -715,7 +836,9 @@ void FMDMetaDataEditorFieldView::OnMetadataKeyTextCommitted(const FText& NewText
 		if (OldKey.IsNone())
 		{
 			AddMetadataKey(*NewText.ToString());
-			RequestRefresh.ExecuteIfBound();
+
+			// Clears the new entry text box, the list picks up the new key on its own
+			RequestMetadataRebuild();
 		}
 		else
 		{
@@ -726,7 +849,8 @@ void FMDMetaDataEditorFieldView::OnMetadataKeyTextCommitted(const FText& NewText
 
 FText FMDMetaDataEditorFieldView::GetMetadataValueText(FName Key) const
 {
-	return FText::FromString(GetMetadataValue(Key).Get(TEXT("")));
+	const FMetadataSnapshotEntry* Entry = FindMetadataSnapshotEntry(Key);
+	return (Entry != nullptr) ? Entry->ValueText : FText::GetEmpty();
 }
 
 void FMDMetaDataEditorFieldView::OnMetadataValueTextCommitted(const FText& NewText, ETextCommit::Type InTextCommit, FName Key)
@@ -754,8 +878,8 @@ void FMDMetaDataEditorFieldView::OnMetadataValueTextCommittedAllowingEmpty(const
 
 TOptional<int32> FMDMetaDataEditorFieldView::GetMetadataValueInt(FName Key) const
 {
-	TOptional<FString> Value = GetMetadataValue(Key);
-	return Value.IsSet() ? TOptional<int32>(FCString::Atoi(*Value.GetValue())) : TOptional<int32>{};
+	const FMetadataSnapshotEntry* Entry = FindMetadataSnapshotEntry(Key);
+	return (Entry != nullptr) ? TOptional<int32>(Entry->IntValue) : TOptional<int32>{};
 }
 
 void FMDMetaDataEditorFieldView::OnMetadataValueIntCommitted(int32 Value, ETextCommit::Type InTextCommit, FName Key)
@@ -768,8 +892,8 @@ void FMDMetaDataEditorFieldView::OnMetadataValueIntCommitted(int32 Value, ETextC
 
 TOptional<float> FMDMetaDataEditorFieldView::GetMetadataValueFloat(FName Key) const
 {
-	TOptional<FString> Value = GetMetadataValue(Key);
-	return Value.IsSet() ? TOptional<float>(FCString::Atof(*Value.GetValue())) : TOptional<float>{};
+	const FMetadataSnapshotEntry* Entry = FindMetadataSnapshotEntry(Key);
+	return (Entry != nullptr) ? TOptional<float>(Entry->FloatValue) : TOptional<float>{};
 }
 
 void FMDMetaDataEditorFieldView::OnMetadataValueFloatCommitted(float Value, ETextCommit::Type InTextCommit, FName Key)
@@ -783,9 +907,9 @@ void FMDMetaDataEditorFieldView::OnMetadataValueFloatCommitted(float Value, ETex
 template <bool bIsBoolean>
 ECheckBoxState FMDMetaDataEditorFieldView::IsChecked(FName Key) const
 {
-	TOptional<FString> Value = GetMetadataValue(Key);
+	const FMetadataSnapshotEntry* Entry = FindMetadataSnapshotEntry(Key);
 
-	if (Value.IsSet() && Value.GetValue() == MultipleValues)
+	if (Entry != nullptr && Entry->bIsMultipleValues)
 	{
 		return ECheckBoxState::Undetermined;
 	}
@@ -793,16 +917,16 @@ ECheckBoxState FMDMetaDataEditorFieldView::IsChecked(FName Key) const
 	if constexpr (bIsBoolean)
 	{
 		// Don't assume unset == false, a metadata key could have different behaviour between the 2.
-		if (!Value.IsSet())
+		if (Entry == nullptr)
 		{
 			return ECheckBoxState::Undetermined;
 		}
 
-		return Value.GetValue().ToBool() ? ECheckBoxState::Checked : ECheckBoxState::Unchecked;
+		return Entry->bBoolValue ? ECheckBoxState::Checked : ECheckBoxState::Unchecked;
 	}
 	else
 	{
-		return Value.IsSet() ? ECheckBoxState::Checked : ECheckBoxState::Unchecked;
+		return (Entry != nullptr) ? ECheckBoxState::Checked : ECheckBoxState::Unchecked;
 	}
 }
 
@@ -863,32 +987,25 @@ void FMDMetaDataEditorFieldView::SetMetadataValue(const FName& Key, const FStrin
 
 		if (UBlueprint* Blueprint = BlueprintPtr.Get())
 		{
-			for (FBPVariableDescription& VariableDescription : Blueprint->NewVariables)
+			// Params and local variables are owned by their function, only properties owned by the class can be member variables
+			FMDMetaDataEditorBlueprintVariableIndex& VariableIndex = FMDMetaDataEditorBlueprintVariableIndex::Get();
+			if (UFunction* Function = Cast<UFunction>(Property->GetOwnerUObject()))
 			{
-				if (VariableDescription.VarName == Property->GetFName())
+				// Is it a local variable?
+				UK2Node_FunctionEntry* FuncNode = nullptr;
+				if (FBPVariableDescription* LocalVariableDescription = VariableIndex.FindLocalVariable(Blueprint, Function, Property->GetFName(), FuncNode))
 				{
-					Blueprint->Modify();
+					ModifyOnce(FuncNode);
 					Property->SetMetaData(Key, FString(Value));
-					VariableDescription.SetMetaData(Key, Value);
-					bDidFindMetaData = true;
+					LocalVariableDescription->SetMetaData(Key, Value);
 				}
 			}
-
-			if (!bDidFindMetaData)
+			else if (FBPVariableDescription* VariableDescription = VariableIndex.FindMemberVariable(Blueprint, Property->GetFName()))
 			{
-				// Is it a local variable?
-				if (UK2Node_FunctionEntry* FuncNode = MDMDEFV_Private::FindFunctionNode(Blueprint, Cast<UFunction>(Property->GetOwnerUObject())))
-				{
-					for (FBPVariableDescription& VariableDescription : FuncNode->LocalVariables)
-					{
-						if (VariableDescription.VarName == Property->GetFName())
-						{
-							FuncNode->Modify();
-							Property->SetMetaData(Key, FString(Value));
-							VariableDescription.SetMetaData(Key, Value);
-						}
-					}
-				}
+				ModifyOnce(Blueprint);
+				Property->SetMetaData(Key, FString(Value));
+				VariableDescription->SetMetaData(Key, Value);
+				bDidFindMetaData = true;
 			}
 		}
 
@@ -896,7 +1013,7 @@ void FMDMetaDataEditorFieldView::SetMetadataValue(const FName& Key, const FStrin
 		{
 			if (UObject* ParamOwner = Property->GetOwnerUObject())
 			{
-				ParamOwner->Modify();
+				ModifyOnce(ParamOwner);
 			}
 
 			Property->SetMetaData(Key, FString(Value));
@@ -913,14 +1030,7 @@ void FMDMetaDataEditorFieldView::SetMetadataValue(const FName& Key, const FStrin
 		Struct->SetMetaData(Key, *Value);
 	}
 
-	if (BlueprintPtr.IsValid())
-	{
-		FBlueprintEditorUtils::MarkBlueprintAsModified(BlueprintPtr.Get());
-	}
-	else
-	{
-		RequestRefresh.ExecuteIfBound();
-	}
+	OnMetadataChanged(Key, &Value);
 }
 
 bool FMDMetaDataEditorFieldView::HasMetadataValue(const FName& Key) const
@@ -941,6 +1051,186 @@ TOptional<FString> FMDMetaDataEditorFieldView::GetMetadataValue(FName Key) const
 	return TOptional<FString>{};
 }
 
+void FMDMetaDataEditorFieldView::UpdateMetadataSnapshot() const
+{
+	const FMDMetaDataKeyIndex& KeyIndex = GetDefault<UMDMetaDataEditorConfig>()->GetKeyIndex();
+	if (SnapshotFrame == GFrameCounter && SnapshotVersion == MetadataVersion && PresentKeysSerial == KeyIndex.GetBuildSerial())
+	{
+		return;
+	}
+
+	SnapshotFrame = GFrameCounter;
+	SnapshotVersion = MetadataVersion;
+
+	// Keys that were added or removed, only the dependent rows of these keys need their visibility re-evaluated
+	TArray<FName, TInlineAllocator<8>> ChangedKeys;
+
+	const TMap<FName, FString>* MetadataMap = GetMetadataMap();
+	for (auto It = MetadataSnapshot.CreateIterator(); It; ++It)
+	{
+		if (MetadataMap == nullptr || !MetadataMap->Contains(It.Key()))
+		{
+			ChangedKeys.Add(It.Key());
+			It.RemoveCurrent();
+		}
+	}
+
+	if (MetadataMap != nullptr)
+	{
+		// Only entries with a changed value need their text and parsed values regenerated
+		for (const TPair<FName, FString>& Pair : *MetadataMap)
+		{
+			FMetadataSnapshotEntry* Entry = MetadataSnapshot.Find(Pair.Key);
+			if (Entry != nullptr && Entry->Value.Equals(Pair.Value, ESearchCase::CaseSensitive))
+			{
+				continue;
+			}
+
+			if (Entry == nullptr)
+			{
+				ChangedKeys.Add(Pair.Key);
+				Entry = &MetadataSnapshot.Add(Pair.Key);
+			}
+
+			Entry->Value = Pair.Value;
+			Entry->ValueText = FText::FromString(Pair.Value);
+			Entry->IntValue = FCString::Atoi(*Pair.Value);
+			Entry->FloatValue = FCString::Atof(*Pair.Value);
+			Entry->bBoolValue = Pair.Value.ToBool();
+			Entry->bIsMultipleValues = Pair.Value == MultipleValues;
+		}
+	}
+
+	const FMDMetaDataKeyDependencyGraph& DependencyGraph = KeyIndex.GetDependencyGraph();
+	if (PresentKeysSerial != KeyIndex.GetBuildSerial())
+	{
+		// The index was rebuilt so the name ids may have changed even if their count didn't, encode everything again
+		PresentKeysSerial = KeyIndex.GetBuildSerial();
+		DependencyGraph.InitPresentKeys(PresentKeys);
+		for (const TPair<FName, FMetadataSnapshotEntry>& Pair : MetadataSnapshot)
+		{
+			DependencyGraph.SetKeyPresent(PresentKeys, Pair.Key, true);
+		}
+	}
+	else
+	{
+		for (const FName& ChangedKey : ChangedKeys)
+		{
+			DependencyGraph.SetKeyPresent(PresentKeys, ChangedKey, MetadataSnapshot.Contains(ChangedKey));
+		}
+	}
+
+	if (RowsSerial != PresentKeysSerial)
+	{
+		// The rows hold key indices and category groups from the previous index, they're regenerated instead of updated
+		if (RowsSerial != 0)
+		{
+			QueueMetadataRebuild();
+		}
+
+		return;
+	}
+
+	for (const FName& ChangedKey : ChangedKeys)
+	{
+		for (auto It = DependentRowsByKey.CreateConstKeyIterator(ChangedKey); It; ++It)
+		{
+			UpdateDependentRowVisibility(DependentRows[It.Value()]);
+		}
+	}
+}
+
+int32 FMDMetaDataEditorFieldView::AddDependentRow(int32 KeyIndex, const FMDMetaDataKey& Key)
+{
+	const FMDMetaDataKeyDependencyGraph& DependencyGraph = GetDefault<UMDMetaDataEditorConfig>()->GetKeyIndex().GetDependencyGraph();
+
+	FDependentRow Row;
+	Row.KeyIndex = KeyIndex;
+	if (!DependencyGraph.HasDependencies(Row.KeyIndex))
+	{
+		return INDEX_NONE;
+	}
+
+	if (VisibleKeys.IsValidIndex(Row.KeyIndex))
+	{
+		Row.Visibility = VisibleKeys[Row.KeyIndex] ? EVisibility::Visible : EVisibility::Collapsed;
+	}
+	else
+	{
+		UpdateMetadataSnapshot();
+		UpdateDependentRowVisibility(Row);
+	}
+
+	const int32 RowIndex = DependentRows.Add(Row);
+	if (Key.RequiredMetaData != Key.Key && !Key.RequiredMetaData.IsNone())
+	{
+		DependentRowsByKey.AddUnique(Key.RequiredMetaData, RowIndex);
+	}
+
+	for (const FName& IncompatibleKey : Key.IncompatibleMetaData)
+	{
+		if (IncompatibleKey != Key.Key && !IncompatibleKey.IsNone())
+		{
+			DependentRowsByKey.AddUnique(IncompatibleKey, RowIndex);
+		}
+	}
+
+	return RowIndex;
+}
+
+void FMDMetaDataEditorFieldView::UpdateDependentRowVisibility(FDependentRow& Row) const
+{
+	const FMDMetaDataKeyDependencyGraph& DependencyGraph = GetDefault<UMDMetaDataEditorConfig>()->GetKeyIndex().GetDependencyGraph();
+	Row.Visibility = DependencyGraph.IsKeyVisible(Row.KeyIndex, PresentKeys) ? EVisibility::Visible : EVisibility::Collapsed;
+}
+
+EVisibility FMDMetaDataEditorFieldView::GetDependentRowVisibility(int32 RowIndex) const
+{
+	UpdateMetadataSnapshot();
+	return DependentRows.IsValidIndex(RowIndex) ? DependentRows[RowIndex].Visibility : EVisibility::Visible;
+}
+
+const FMDMetaDataEditorFieldView::FMetadataSnapshotEntry* FMDMetaDataEditorFieldView::FindMetadataSnapshotEntry(FName Key) const
+{
+	UpdateMetadataSnapshot();
+	return MetadataSnapshot.Find(Key);
+}
+
+void FMDMetaDataEditorFieldView::SetMetadataValues(const TMap<FName, FString>& Values)
+{
+	if (Values.IsEmpty())
+	{
+		return;
+	}
+
+	FScopedMetadataBatch Batch(*this, FText::Format(INVTEXT("Set Meta Data [{0} keys]"), FText::AsNumber(Values.Num())));
+	for (const TPair<FName, FString>& Pair : Values)
+	{
+		SetMetadataValue(Pair.Key, Pair.Value);
+	}
+}
+
+FMDMetaDataEditorFieldView::FScopedMetadataBatch::FScopedMetadataBatch(FMDMetaDataEditorFieldView& InFieldView, const FText& Description)
+	: FieldView(InFieldView.AsShared())
+{
+	if (FieldView->BatchDepth++ == 0)
+	{
+		Transaction = MakeUnique<FScopedTransaction>(Description);
+	}
+}
+
+FMDMetaDataEditorFieldView::FScopedMetadataBatch::~FScopedMetadataBatch()
+{
+	if (--FieldView->BatchDepth == 0)
+	{
+		FieldView->BatchModifiedObjects.Reset();
+		FieldView->FinishMetadataChanges();
+	}
+
+	// Close the transaction after finishing so the recompile is part of it, like it is for a single edit
+	Transaction.Reset();
+}
+
 void FMDMetaDataEditorFieldView::SetMetadataKey(const FName& OldKey, const FName& NewKey)
 {
 	if (HasMetadataValue(NewKey))
@@ -955,7 +1245,7 @@ void FMDMetaDataEditorFieldView::SetMetadataKey(const FName& OldKey, const FName
 		return;
 	}
 
-	FScopedTransaction Transaction(FText::Format(INVTEXT("Changed Meta Data Key [{0} -> {1}]"), FText::FromName(OldKey), FText::FromName(NewKey)));
+	FScopedMetadataBatch Batch(*this, FText::Format(INVTEXT("Changed Meta Data Key [{0} -> {1}]"), FText::FromName(OldKey), FText::FromName(NewKey)));
 	RemoveMetadataKey(OldKey);
 	SetMetadataValue(NewKey, Value.GetValue());
 }
@@ -975,32 +1265,25 @@ void FMDMetaDataEditorFieldView::RemoveMetadataKey(const FName& Key)
 
 		if (UBlueprint* Blueprint = BlueprintPtr.Get())
 		{
-			for (FBPVariableDescription& VariableDescription : Blueprint->NewVariables)
+			// Params and local variables are owned by their function, only properties owned by the class can be member variables
+			FMDMetaDataEditorBlueprintVariableIndex& VariableIndex = FMDMetaDataEditorBlueprintVariableIndex::Get();
+			if (UFunction* Function = Cast<UFunction>(Property->GetOwnerUObject()))
 			{
-				if (VariableDescription.VarName == Property->GetFName())
+				// Is it a local variable?
+				UK2Node_FunctionEntry* FuncNode = nullptr;
+				if (FBPVariableDescription* LocalVariableDescription = VariableIndex.FindLocalVariable(Blueprint, Function, Property->GetFName(), FuncNode))
 				{
-					Blueprint->Modify();
+					ModifyOnce(FuncNode);
 					Property->RemoveMetaData(Key);
-					VariableDescription.RemoveMetaData(Key);
-					bDidFindMetaData = false;
+					LocalVariableDescription->RemoveMetaData(Key);
 				}
 			}
-
-			if (!bDidFindMetaData)
+			else if (FBPVariableDescription* VariableDescription = VariableIndex.FindMemberVariable(Blueprint, Property->GetFName()))
 			{
-				// Is it a local variable?
-				if (UK2Node_FunctionEntry* FuncNode = MDMDEFV_Private::FindFunctionNode(Blueprint, Cast<UFunction>(Property->GetOwnerUObject())))
-				{
-					for (FBPVariableDescription& VariableDescription : FuncNode->LocalVariables)
-					{
-						if (VariableDescription.VarName == Property->GetFName())
-						{
-							FuncNode->Modify();
-							Property->RemoveMetaData(Key);
-							VariableDescription.RemoveMetaData(Key);
-						}
-					}
-				}
+				ModifyOnce(Blueprint);
+				Property->RemoveMetaData(Key);
+				VariableDescription->RemoveMetaData(Key);
+				bDidFindMetaData = true;
 			}
 		}
 
@@ -1009,7 +1292,7 @@ void FMDMetaDataEditorFieldView::RemoveMetadataKey(const FName& Key)
 		{
 			if (UObject* ParamOwner = Property->GetOwnerUObject())
 			{
-				ParamOwner->Modify();
+				ModifyOnce(ParamOwner);
 			}
 
 			Property->RemoveMetaData(Key);
@@ -1026,82 +1309,205 @@ void FMDMetaDataEditorFieldView::RemoveMetadataKey(const FName& Key)
 		Struct->RemoveMetaData(Key);
 	}
 
-	if (BlueprintPtr.IsValid())
+	OnMetadataChanged(Key, nullptr);
+}
+
+void FMDMetaDataEditorFieldView::OnMetadataChanged(const FName& Key, const FString* Value)
+{
+	++MetadataVersion;
+	++NumPendingChanges;
+
+	UBlueprint* Blueprint = BlueprintPtr.Get();
+	if (IsValid(Blueprint) && !GetDefault<UMDMetaDataEditorUserConfig>()->bMarkBlueprintModifiedOnMetaDataChange)
+	{
+		// The source data (variable descriptions, nodes) is already updated so the next compile will produce the same result,
+		// patch the compiled classes so the change is visible immediately without regenerating the skeleton or reinstancing
+		const double StartTime = FPlatformTime::Seconds();
+		PatchCompiledMetadata(Blueprint, Key, Value);
+		PendingPatchSeconds += FPlatformTime::Seconds() - StartTime;
+	}
+
+	if (BatchDepth == 0)
+	{
+		FinishMetadataChanges();
+	}
+}
+
+void FMDMetaDataEditorFieldView::FinishMetadataChanges()
+{
+	if (NumPendingChanges == 0)
+	{
+		return;
+	}
+
+	MDMDE_SCOPE_CYCLE_COUNTER(STAT_MDMetaDataEditor_FinishMetadataChanges);
+
+	const int32 NumChanges = NumPendingChanges;
+	const double PatchSeconds = PendingPatchSeconds;
+	NumPendingChanges = 0;
+	PendingPatchSeconds = 0;
+
+	// Nothing needs rebuilding, values are bound to the snapshot and dependent rows update their visibility from it
+
+	UBlueprint* Blueprint = BlueprintPtr.Get();
+	if (!IsValid(Blueprint))
+	{
+		return;
+	}
+
+	if (GetDefault<UMDMetaDataEditorUserConfig>()->bMarkBlueprintModifiedOnMetaDataChange)
 	{
-		FBlueprintEditorUtils::MarkBlueprintAsModified(BlueprintPtr.Get());
+		const double StartTime = FPlatformTime::Seconds();
+		FBlueprintEditorUtils::MarkBlueprintAsModified(Blueprint);
+
+		UE_LOG(LogMDMetaDataEditor, Verbose, TEXT("Marked [%s] as modified for %d meta data change(s) in %.3f ms"), *Blueprint->GetName(), NumChanges, (FPlatformTime::Seconds() - StartTime) * 1000.0);
 	}
 	else
 	{
-		RequestRefresh.ExecuteIfBound();
+		Blueprint->MarkPackageDirty();
+
+		UE_LOG(LogMDMetaDataEditor, Verbose, TEXT("Patched compiled meta data on [%s] for %d meta data change(s) in %.3f ms"), *Blueprint->GetName(), NumChanges, PatchSeconds * 1000.0);
 	}
 }
 
-void FMDMetaDataEditorFieldView::CopyMetadata(FName Key) const
+void FMDMetaDataEditorFieldView::QueueMetadataRebuild() const
 {
-	const TOptional<FString> Value = GetMetadataValue(Key);
+	if (bIsRebuildQueued)
+	{
+		return;
+	}
 
-	// Copy in Key=Value format
-	FPlatformApplicationMisc::ClipboardCopy(*FString::Printf(TEXT("%s=\"%s\""), *Key.ToString(), *Value.Get(TEXT("")).ReplaceCharWithEscapedChar()));
+	bIsRebuildQueued = true;
+
+	// Rebuilding can destroy the rows currently being painted, so wait for the next tick
+	TWeakPtr<FMDMetaDataEditorFieldView> WeakThis = ConstCastSharedRef<FMDMetaDataEditorFieldView>(AsShared());
+	FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateLambda([WeakThis](float DeltaTime)
+	{
+		if (const TSharedPtr<FMDMetaDataEditorFieldView> FieldView = WeakThis.Pin())
+		{
+			FieldView->bIsRebuildQueued = false;
+			FieldView->RequestMetadataRebuild();
+		}
+
+		return false;
+	}));
 }
 
-bool FMDMetaDataEditorFieldView::CanCopyMetadata(FName Key) const
+void FMDMetaDataEditorFieldView::RequestMetadataRebuild()
 {
-	return HasMetadataValue(Key);
+	if (const TSharedPtr<FMDMetaDataEditorFieldViewNodeBuilder> Builder = NodeBuilder.Pin())
+	{
+		MDMDE_SCOPE_CYCLE_COUNTER(STAT_MDMetaDataEditor_RefreshDetails);
+		Builder->RebuildChildren();
+	}
+	else
+	{
+		RequestRefresh.ExecuteIfBound();
+	}
 }
 
-void FMDMetaDataEditorFieldView::PasteMetadata(FName Key)
+void FMDMetaDataEditorFieldView::ModifyOnce(UObject* Object) const
 {
-	FString Clipboard;
-	FPlatformApplicationMisc::ClipboardPaste(Clipboard);
-	Clipboard.TrimStartAndEndInline();
+	if (Object == nullptr)
+	{
+		return;
+	}
 
-	// Handle pasting the same metadata format used in C++
-	int32 EqualIndex = INDEX_NONE;
-	if (Clipboard.FindChar(TEXT('='), EqualIndex) && EqualIndex > 0)
+	if (BatchDepth > 0)
 	{
-		// Skip if the clipboard has != or == without starting with "Key=" (like a raw edit condition) but ending with = means a blank value
-		if (Clipboard[EqualIndex - 1] != TEXT('!') && (EqualIndex == (Clipboard.Len() - 1) || Clipboard[EqualIndex + 1] != TEXT('=')))
+		bool bIsAlreadyModified = false;
+		BatchModifiedObjects.Add(Object, &bIsAlreadyModified);
+		if (bIsAlreadyModified)
 		{
-			// Allow paste if the key matches
-			const FString ClipKey = Clipboard.Left(EqualIndex).TrimStartAndEnd();
-			if (*ClipKey != Key)
-			{
-				return;
-			}
+			return;
+		}
+	}
+
+	Object->Modify();
+}
 
-			const FString ClipValue = Clipboard.Mid(EqualIndex + 1).TrimStartAndEnd().TrimQuotes();
-			SetMetadataValue(Key, Clipboard.ReplaceEscapedCharWithChar());
+void FMDMetaDataEditorFieldView::PatchCompiledMetadata(UBlueprint* Blueprint, const FName& Key, const FString* Value) const
+{
+	auto PatchField = [&Key, Value](auto* Field)
+	{
+		if (Value != nullptr)
+		{
+			Field->SetMetaData(Key, FString(*Value));
+		}
+		else
+		{
+			Field->RemoveMetaData(Key);
 		}
+	};
+
+	FName FunctionName = NAME_None;
+	if (const UK2Node_FunctionEntry* FuncNode = MetadataFunctionEntry.Get())
+	{
+		FunctionName = FuncNode->FunctionReference.GetMemberName();
 	}
+	else if (const UK2Node_CustomEvent* EventNode = MetadataCustomEvent.Get())
+	{
+		FunctionName = EventNode->CustomFunctionName;
+	}
+
+	const FProperty* Property = MetadataProperty.Get();
+	const UFunction* PropertyFunction = (Property != nullptr) ? Cast<UFunction>(Property->GetOwnerUObject()) : nullptr;
 
-	// Clipboard is just the value
-	if (!Clipboard.IsEmpty())
+	for (UClass* Class : { Blueprint->GeneratedClass.Get(), Blueprint->SkeletonGeneratedClass.Get() })
 	{
-		Clipboard.TrimQuotesInline();
-		SetMetadataValue(Key, Clipboard.ReplaceEscapedCharWithChar());
+		if (!IsValid(Class))
+		{
+			continue;
+		}
+
+		if (Property != nullptr)
+		{
+			const UStruct* Owner = (PropertyFunction != nullptr)
+				? Class->FindFunctionByName(PropertyFunction->GetFName(), EIncludeSuperFlag::ExcludeSuper)
+				: Class;
+
+			// The edited property already has the change, it lives on one of these classes
+			FProperty* CompiledProperty = (Owner != nullptr) ? Owner->FindPropertyByName(Property->GetFName()) : nullptr;
+			if (CompiledProperty != nullptr && CompiledProperty != Property)
+			{
+				PatchField(CompiledProperty);
+			}
+		}
+		else if (!FunctionName.IsNone())
+		{
+			if (UFunction* Function = Class->FindFunctionByName(FunctionName, EIncludeSuperFlag::ExcludeSuper))
+			{
+				PatchField(Function);
+			}
+		}
 	}
 }
 
-bool FMDMetaDataEditorFieldView::CanPasteMetadata(FName Key) const
+void FMDMetaDataEditorFieldView::CopyMetadata(FName Key) const
+{
+	const TOptional<FString> Value = GetMetadataValue(Key);
+
+	// Copy in Key=Value format
+	FPlatformApplicationMisc::ClipboardCopy(*FString::Printf(TEXT("%s=\"%s\""), *Key.ToString(), *Value.Get(TEXT("")).ReplaceCharWithEscapedChar()));
+	MDMDEFV_Private::InvalidateParsedClipboard();
+}
+
+bool FMDMetaDataEditorFieldView::CanCopyMetadata(FName Key) const
 {
-	FString Clipboard;
-	FPlatformApplicationMisc::ClipboardPaste(Clipboard);
-	Clipboard.TrimStartAndEndInline();
+	return HasMetadataValue(Key);
+}
 
-	// Handle pasting the same metadata format used in C++
-	int32 EqualIndex = INDEX_NONE;
-	if (Clipboard.FindChar(TEXT('='), EqualIndex) && EqualIndex > 0)
+void FMDMetaDataEditorFieldView::PasteMetadata(FName Key)
+{
+	const MDMDEFV_Private::FParsedClipboard& ParsedClipboard = MDMDEFV_Private::GetParsedClipboard();
+	if (ParsedClipboard.CanPasteTo(Key))
 	{
-		// Skip if the clipboard has != or == without starting with "Key=" (like a raw edit condition) but ending with = means a blank value
-		if (Clipboard[EqualIndex - 1] != TEXT('!') && (EqualIndex == (Clipboard.Len() - 1) || Clipboard[EqualIndex + 1] != TEXT('=')))
-		{
-			// Allow paste if the key matches
-			Clipboard.LeftInline(EqualIndex);
-			Clipboard.TrimStartAndEndInline();
-			return *Clipboard == Key;
-		}
+		FScopedMetadataBatch Batch(*this, FText::Format(INVTEXT("Paste Meta Data [{0}]"), FText::FromName(Key)));
+		SetMetadataValue(Key, ParsedClipboard.Value);
 	}
+}
 
-	// Clipboard is just the value
-	return !Clipboard.IsEmpty();
+bool FMDMetaDataEditorFieldView::CanPasteMetadata(FName Key) const
+{
+	return MDMDEFV_Private::GetParsedClipboard().CanPasteTo(Key);
 }
@@ -2,16 +2,20 @@
 
 #pragma once
 
+#include "Containers/BitArray.h"
 #include "Containers/Union.h"
 #include "Input/Reply.h"
 #include "Layout/Visibility.h"
 #include "SCheckBoxList.h"
 #include "Templates/SharedPointer.h"
+#include "UObject/ObjectKey.h"
 #include "UObject/WeakFieldPtr.h"
 #include "UObject/WeakObjectPtrTemplates.h"
 
 class UK2Node_EditablePinBase;
+class FMDMetaDataEditorFieldViewNodeBuilder;
 class IDetailCategoryBuilder;
+class IDetailChildrenBuilder;
 class IDetailLayoutBuilder;
 struct FMDMetaDataKey;
 struct FKismetUserDeclaredFunctionMetadata;
@@ -21,6 +25,8 @@ namespace ETextCommit
 	enum Type : int;
 }
 
+class FDetailWidgetRow;
+class FScopedTransaction;
 class IDetailGroup;
 class UUserDefinedStruct;
 class UBlueprint;
@@ -60,19 +66,63 @@ public:
 
 	void GenerateMetadataEditor(IDetailLayoutBuilder& DetailLayout, TMap<FName, IDetailGroup*>& GroupMap);
 
-	typedef TUnion<IDetailCategoryBuilder*, IDetailGroup*> FMDMetadataBuilderRow;
+	typedef TUnion<IDetailCategoryBuilder*, IDetailGroup*, IDetailChildrenBuilder*> FMDMetadataBuilderRow;
 	FMDMetadataBuilderRow InitCategories(IDetailLayoutBuilder& DetailLayout, TMap<FName, IDetailGroup*>& GroupMap);
+	void GenerateMetadataRows(FMDMetadataBuilderRow BuilderRow);
 
-	void AddMetadataValueEditor(const TFunctionRef<void(const FMDMetaDataKey&)>& Func);
-	void AddMetadataValueEditor(const FMDMetaDataKey& Key, FMDMetadataBuilderRow BuilderRow, TMap<FName, IDetailGroup*>& GroupMap);
+	void AddMetadataValueEditor(const TFunctionRef<void(int32, const FMDMetaDataKey&)>& Func);
+	void AddMetadataValueEditor(int32 KeyIndex, const FMDMetaDataKey& Key, FMDMetadataBuilderRow BuilderRow);
 	void AddRawMetadataEditor(FMDMetadataBuilderRow BuilderRow);
 
 	bool IsConfigEnabled() const;
 
+	// The memory held by this view's caches, not including the widgets of its rows
+	SIZE_T GetAllocatedSize() const;
+
+	// Groups every metadata edit made through the field view while in scope into a single transaction, a single Modify() per object,
+	// and a single recompile/refresh once the outermost batch ends
+	class MDMETADATAEDITOR_API FScopedMetadataBatch
+	{
+	public:
+		FScopedMetadataBatch(FMDMetaDataEditorFieldView& InFieldView, const FText& Description);
+		~FScopedMetadataBatch();
+
+	private:
+		TSharedRef<FMDMetaDataEditorFieldView> FieldView;
+		TUniquePtr<FScopedTransaction> Transaction;
+	};
+
+	void SetMetadataValue(const FName& Key, const FString& Value);
+	void SetMetadataValues(const TMap<FName, FString>& Values);
+	bool HasMetadataValue(const FName& Key) const;
+	TOptional<FString> GetMetadataValue(FName Key) const;
+	void SetMetadataKey(const FName& OldKey, const FName& NewKey);
+	void RemoveMetadataKey(const FName& Key);
+
+	// Rebuilds the whole details panel, only needed for structural changes
 	FSimpleDelegate RequestRefresh;
 
+	// Rebuilds only the rows of this view when it owns its category, otherwise falls back to RequestRefresh
+	void RequestMetadataRebuild();
+
 private:
+	// Adds a group that starts with the expansion state the user last left it in
+	static IDetailGroup& AddMetadataGroup(FMDMetadataBuilderRow Parent, FName GroupName, const FText& DisplayName, const FString& ExpansionPath, bool bDefaultExpanded);
+	static FDetailWidgetRow& AddMetadataRow(FMDMetadataBuilderRow Parent, const FText& FilterText);
+	static bool IsBuilderRowValid(const FMDMetadataBuilderRow& BuilderRow);
+
+	// The group created for a node of the config's category tree, see FMDMetaDataKeyIndex::GetCategoryNodes
+	struct FCategoryGroup
+	{
+		IDetailGroup* Group = nullptr;
+		// False if this group or any of its parents is collapsed
+		bool bIsExpanded = true;
+	};
+
+	const FCategoryGroup& FindOrAddCategoryGroup(int32 NodeId, FMDMetadataBuilderRow BuilderRow);
+
 	TSharedRef<SWidget> CreateMetaDataValueWidget(const FMDMetaDataKey& Key);
+	TSharedRef<SWidget> CreateRawMetadataListWidget();
 
 	EVisibility GetRemoveMetadataButtonVisibility(FName Key) const;
 	FReply OnRemoveMetadata(FName Key);
@@ -97,11 +147,44 @@ private:
 	FText GetCheckBoxToolTip(FName Key) const;
 
 	void AddMetadataKey(const FName& Key);
-	void SetMetadataValue(const FName& Key, const FString& Value);
-	bool HasMetadataValue(const FName& Key) const;
-	TOptional<FString> GetMetadataValue(FName Key) const;
-	void SetMetadataKey(const FName& OldKey, const FName& NewKey);
-	void RemoveMetadataKey(const FName& Key);
+
+	// Only calls Modify() once per object while batching
+	void ModifyOnce(UObject* Object) const;
+
+	// Value is null if the key was removed
+	void OnMetadataChanged(const FName& Key, const FString* Value);
+	void FinishMetadataChanges();
+	void PatchCompiledMetadata(UBlueprint* Blueprint, const FName& Key, const FString* Value) const;
+
+	// Cached view of a metadata value so Slate attribute getters don't look up and convert the value on every paint
+	struct FMetadataSnapshotEntry
+	{
+		FString Value;
+		FText ValueText;
+		int32 IntValue = 0;
+		float FloatValue = 0.f;
+		bool bBoolValue = false;
+		bool bIsMultipleValues = false;
+	};
+
+	void UpdateMetadataSnapshot() const;
+
+	// Regenerates the rows on the next tick, for when the key index was rebuilt under them while they're being painted
+	void QueueMetadataRebuild() const;
+	const FMetadataSnapshotEntry* FindMetadataSnapshotEntry(FName Key) const;
+
+	// A row that is hidden depending on which other keys are set (RequiredMetaData, IncompatibleMetaData)
+	struct FDependentRow
+	{
+		// Index into the config's keys, resolved against its dependency graph
+		int32 KeyIndex = INDEX_NONE;
+		EVisibility Visibility = EVisibility::Visible;
+	};
+
+	// Returns INDEX_NONE if Key's row doesn't depend on other keys
+	int32 AddDependentRow(int32 KeyIndex, const FMDMetaDataKey& Key);
+	void UpdateDependentRowVisibility(FDependentRow& Row) const;
+	EVisibility GetDependentRowVisibility(int32 RowIndex) const;
 
 	void CopyMetadata(FName Key) const;
 	bool CanCopyMetadata(FName Key) const;
@@ -116,5 +199,42 @@ private:
 	TWeakObjectPtr<UBlueprint> BlueprintPtr;
 
 	bool bIsReadOnly = false;
+
+	// Set by InitCategories, rows under a collapsed group only build their widgets once the group is expanded
+	FString ExpansionPathRoot;
+	bool bIsBuilderRowExpanded = true;
+
+	// Indexed by category node id, only valid while generating rows
+	TArray<FCategoryGroup> CategoryGroups;
+
+	// Only set if this view owns its category, see GenerateMetadataEditor
+	TWeakPtr<FMDMetaDataEditorFieldViewNodeBuilder> NodeBuilder;
+
+	// Dependent row visibility is only re-evaluated for the rows that depend on a key that was added or removed since the last snapshot
+	mutable TArray<FDependentRow> DependentRows;
+	TMultiMap<FName, int32> DependentRowsByKey;
+
+	// The keys in the snapshot encoded with the config's dependency graph, kept up to date along with the snapshot
+	mutable TBitArray<> PresentKeys;
+
+	// The key index builds that PresentKeys and the rows (DependentRows, CategoryGroups) were made from, see FMDMetaDataKeyIndex::GetBuildSerial
+	mutable uint32 PresentKeysSerial = 0;
+	uint32 RowsSerial = 0;
+	mutable bool bIsRebuildQueued = false;
+
+	// The visibility of every config key when the rows were last generated
+	TBitArray<> VisibleKeys;
+
 	EMDMetaDataEditorFieldType FieldType = EMDMetaDataEditorFieldType::Unknown;
+
+	// Bumped whenever this view changes the metadata, the snapshot is also revalidated once per frame to catch external changes (undo, other views, etc.)
+	uint32 MetadataVersion = 0;
+	mutable uint32 SnapshotVersion = 0;
+	mutable uint64 SnapshotFrame = MAX_uint64;
+	mutable TMap<FName, FMetadataSnapshotEntry> MetadataSnapshot;
+
+	int32 BatchDepth = 0;
+	int32 NumPendingChanges = 0;
+	double PendingPatchSeconds = 0;
+	mutable TSet<TObjectKey<UObject>> BatchModifiedObjects;
 };
@@ -0,0 +1,34 @@
+// Copyright Dylan Dumesnil. All Rights Reserved.
+
+#include "MDMetaDataEditorFieldViewNodeBuilder.h"
+
+#include "IDetailChildrenBuilder.h"
+#include "MDMetaDataEditorFieldView.h"
+
+FMDMetaDataEditorFieldViewNodeBuilder::FMDMetaDataEditorFieldViewNodeBuilder(const TSharedRef<FMDMetaDataEditorFieldView>& InFieldView)
+	: FieldView(InFieldView)
+{
+}
+
+void FMDMetaDataEditorFieldViewNodeBuilder::SetOnRebuildChildren(FSimpleDelegate InOnRebuildChildren)
+{
+	OnRebuildChildren = MoveTemp(InOnRebuildChildren);
+}
+
+void FMDMetaDataEditorFieldViewNodeBuilder::GenerateChildContent(IDetailChildrenBuilder& ChildrenBuilder)
+{
+	if (const TSharedPtr<FMDMetaDataEditorFieldView> FieldViewPtr = FieldView.Pin())
+	{
+		FieldViewPtr->GenerateMetadataRows(FMDMetaDataEditorFieldView::FMDMetadataBuilderRow(&ChildrenBuilder));
+	}
+}
+
+FName FMDMetaDataEditorFieldViewNodeBuilder::GetName() const
+{
+	return TEXT("MDMetaDataEditorFieldView");
+}
+
+void FMDMetaDataEditorFieldViewNodeBuilder::RebuildChildren() const
+{
+	OnRebuildChildren.ExecuteIfBound();
+}
@@ -0,0 +1,31 @@
+// Copyright Dylan Dumesnil. All Rights Reserved.
+
+#pragma once
+
+#include "IDetailCustomNodeBuilder.h"
+#include "Templates/SharedPointer.h"
+
+class FMDMetaDataEditorFieldView;
+
+/**
+ * Generates the rows of a field view that owns its whole category.
+ * Its children can be rebuilt on their own, without refreshing the rest of the details panel.
+ */
+class FMDMetaDataEditorFieldViewNodeBuilder : public IDetailCustomNodeBuilder
+{
+public:
+	explicit FMDMetaDataEditorFieldViewNodeBuilder(const TSharedRef<FMDMetaDataEditorFieldView>& InFieldView);
+
+	virtual void SetOnRebuildChildren(FSimpleDelegate InOnRebuildChildren) override;
+	// No header, the rows are shown directly in the category
+	virtual void GenerateHeaderRowContent(FDetailWidgetRow& NodeRow) override {}
+	virtual void GenerateChildContent(IDetailChildrenBuilder& ChildrenBuilder) override;
+	virtual bool InitiallyCollapsed() const override { return false; }
+	virtual FName GetName() const override;
+
+	void RebuildChildren() const;
+
+private:
+	TWeakPtr<FMDMetaDataEditorFieldView> FieldView;
+	FSimpleDelegate OnRebuildChildren;
+};
@@ -3,9 +3,32 @@
 
 #include "MDMetaDataEditorStructChangeHandler.h"
 
+#include "MDMetaDataEditorModule.h"
+#include "MDMetaDataEditorStats.h"
 #include "UObject/MetaData.h"
 #include "UObject/Package.h"
 
+namespace MDMDESCH_Private
+{
+	// Keeps any entries the change (re)created, like a tooltip from the struct's variable description, and moves back the rest
+	void RestoreMetaData(TMap<FName, FString>& CachedMetaData, TMap<FName, FString>& MetaDataMap)
+	{
+		if (MetaDataMap.IsEmpty())
+		{
+			MetaDataMap = MoveTemp(CachedMetaData);
+			return;
+		}
+
+		for (TPair<FName, FString>& Pair : CachedMetaData)
+		{
+			if (!MetaDataMap.Contains(Pair.Key))
+			{
+				MetaDataMap.Add(Pair.Key, MoveTemp(Pair.Value));
+			}
+		}
+	}
+}
+
 void FMDMetaDataEditorStructChangeHandler::PreChange(const UUserDefinedStruct* Struct, FStructureEditorUtils::EStructureEditorChangeInfo Info)
 {
 	if (IsValid(Struct))
@@ -13,6 +36,11 @@ void FMDMetaDataEditorStructChangeHandler::PreChange(const UUserDefinedStruct* S
 		FMDMetaDataEditorCachedStructMetadata& Cache = CachedStructMetadata.FindOrAdd(Struct);
 		if (Cache.Count++ == 0)
 		{
+			MDMDE_SCOPE_CYCLE_COUNTER(STAT_MDMetaDataEditor_StructPreChange);
+
+			// The struct's own map is copied since the struct object survives the change and its meta data must stay readable meanwhile.
+			// Property maps are moved out instead, the struct recompiles (recreating its properties) for every kind of change
+			// so those maps are either destroyed or restored from the cache in PostChange, and no strings are copied for them
 #if ENGINE_MAJOR_VERSION > 5 || (ENGINE_MAJOR_VERSION == 5 && ENGINE_MINOR_VERSION >= 6) // On or after UE 5.6
 			if (TMap<FName, FString>* MetaDataMap = FMetaData::GetMapForObject(Struct))
 #else // Pre UE 5.6
@@ -24,9 +52,17 @@ void FMDMetaDataEditorStructChangeHandler::PreChange(const UUserDefinedStruct* S
 
 			for (TFieldIterator<FProperty> PropertyIter(Struct); PropertyIter; ++PropertyIter)
 			{
-				if (const TMap<FName, FString>* PropertyMetaDataMap = PropertyIter->GetMetaDataMap())
+				// FField only exposes its meta data map as const, but the property itself is mutable
+				TMap<FName, FString>* PropertyMetaDataMap = const_cast<TMap<FName, FString>*>(PropertyIter->GetMetaDataMap());
+				if (PropertyMetaDataMap == nullptr || PropertyMetaDataMap->IsEmpty())
 				{
-					Cache.PropertyMetadata.FindOrAdd(PropertyIter->GetFName()) = *PropertyMetaDataMap;
+					continue;
+				}
+
+				const FGuid PropertyGuid = FStructureEditorUtils::GetGuidForProperty(*PropertyIter);
+				if (PropertyGuid.IsValid())
+				{
+					Cache.PropertyMetadata.Add(PropertyGuid, MoveTemp(*PropertyMetaDataMap));
 				}
 			}
 		}
@@ -41,21 +77,37 @@ void FMDMetaDataEditorStructChangeHandler::PostChange(const UUserDefinedStruct*
 		{
 			if (--Cache->Count == 0)
 			{
+				MDMDE_SCOPE_CYCLE_COUNTER(STAT_MDMetaDataEditor_StructPostChange);
+
 #if ENGINE_MAJOR_VERSION > 5 || (ENGINE_MAJOR_VERSION == 5 && ENGINE_MINOR_VERSION >= 6) // On or after UE 5.6
 				TMap<FName, FString>& MetaDataMap = Struct->GetOutermost()->GetMetaData().ObjectMetaDataMap.FindOrAdd(Struct);
 #else // Pre UE 5.6
 				TMap<FName, FString>& MetaDataMap = Struct->GetOutermost()->GetMetaData()->ObjectMetaDataMap.FindOrAdd(Struct);
 #endif
-				MetaDataMap.Append(MoveTemp(Cache->StructMetadata));
+				MDMDESCH_Private::RestoreMetaData(Cache->StructMetadata, MetaDataMap);
 
-				for (TFieldIterator<FProperty> PropertyIter(Struct); PropertyIter; ++PropertyIter)
+				int32 NumRestoredProperties = 0;
+				if (!Cache->PropertyMetadata.IsEmpty())
 				{
-					if (TMap<FName, FString>* PropertyMetaDataMap = Cache->PropertyMetadata.Find(PropertyIter->GetFName()))
+					for (TFieldIterator<FProperty> PropertyIter(Struct); PropertyIter; ++PropertyIter)
 					{
-						PropertyIter->AppendMetaData(*PropertyMetaDataMap);
+						if (TMap<FName, FString>* CachedPropertyMetaData = Cache->PropertyMetadata.Find(FStructureEditorUtils::GetGuidForProperty(*PropertyIter)))
+						{
+							++NumRestoredProperties;
+							for (TPair<FName, FString>& Pair : *CachedPropertyMetaData)
+							{
+								if (!PropertyIter->HasMetaData(Pair.Key))
+								{
+									PropertyIter->SetMetaData(Pair.Key, MoveTemp(Pair.Value));
+								}
+							}
+						}
 					}
 				}
 
+				MDMDE_INC_COUNTER(MDMetaDataEditor_StructPropertiesRestored, NumRestoredProperties);
+				UE_LOG(LogMDMetaDataEditor, Verbose, TEXT("Restored meta data on %d of %d cached properties of [%s]"), NumRestoredProperties, Cache->PropertyMetadata.Num(), *Struct->GetName());
+
 				CachedStructMetadata.Remove(Struct);
 			}
 		}
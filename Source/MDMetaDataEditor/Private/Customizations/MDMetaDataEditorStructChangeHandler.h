@@ -9,7 +9,8 @@ struct FMDMetaDataEditorCachedStructMetadata
 {
 	int32 Count = 0;
 	TMap<FName, FString> StructMetadata;
-	TMap<FName, TMap<FName, FString>> PropertyMetadata;
+	// Keyed by the struct variable's GUID so the meta data follows renamed and reordered properties
+	TMap<FGuid, TMap<FName, FString>> PropertyMetadata;
 };
 
 // Structs recreate their properties when compiled (just like classes) so this object will cache the metadata before compiling and
@@ -4,65 +4,184 @@
 
 #include "BlueprintEditorModule.h"
 #include "Config/MDMetaDataEditorConfig.h"
+#include "Customizations/MDMetaDataEditorBlueprintVariableIndex.h"
 #include "Customizations/MDMetaDataEditorFunctionCustomization.h"
 #include "Customizations/MDMetaDataEditorPropertyTypeCustomization.h"
 #include "Customizations/MDMetaDataEditorStructChangeHandler.h"
 #include "Customizations/MDMetaDataEditorVariableCustomization.h"
 #include "Engine/UserDefinedStruct.h"
+#include "Internationalization/Internationalization.h"
 #include "K2Node_CustomEvent.h"
 #include "K2Node_FunctionEntry.h"
 #include "K2Node_Tunnel.h"
+#include "MDMetaDataEditorStats.h"
 #include "Modules/ModuleManager.h"
 #include "PropertyEditorModule.h"
+#include "UObject/UObjectGlobals.h"
 #include "Widgets/Docking/SDockTab.h"
 #include "Widgets/SMDUserStructMetaDataEditor.h"
 
+DEFINE_LOG_CATEGORY(LogMDMetaDataEditor);
+
+UE_TRACE_CHANNEL_DEFINE(MDMetaDataEditorChannel);
+
+DEFINE_STAT(STAT_MDMetaDataEditor_BuildKeyIndex);
+DEFINE_STAT(STAT_MDMetaDataEditor_ForEachMetaDataKey);
+DEFINE_STAT(STAT_MDMetaDataEditor_GenerateMetadataEditor);
+DEFINE_STAT(STAT_MDMetaDataEditor_AddMetadataValueEditor);
+DEFINE_STAT(STAT_MDMetaDataEditor_AddRawMetadataEditor);
+DEFINE_STAT(STAT_MDMetaDataEditor_FinishMetadataChanges);
+DEFINE_STAT(STAT_MDMetaDataEditor_RefreshDetails);
+DEFINE_STAT(STAT_MDMetaDataEditor_StructPreChange);
+DEFINE_STAT(STAT_MDMetaDataEditor_StructPostChange);
+
+DEFINE_STAT(STAT_MDMetaDataEditor_KeysEvaluated);
+DEFINE_STAT(STAT_MDMetaDataEditor_KeysMatched);
+DEFINE_STAT(STAT_MDMetaDataEditor_RowsBuilt);
+DEFINE_STAT(STAT_MDMetaDataEditor_StructPropertiesRestored);
+
+TRACE_DECLARE_INT_COUNTER(MDMetaDataEditor_KeysEvaluated, TEXT("MDMetaDataEditor/KeysEvaluated"));
+TRACE_DECLARE_INT_COUNTER(MDMetaDataEditor_KeysMatched, TEXT("MDMetaDataEditor/KeysMatched"));
+TRACE_DECLARE_INT_COUNTER(MDMetaDataEditor_RowsBuilt, TEXT("MDMetaDataEditor/RowsBuilt"));
+TRACE_DECLARE_INT_COUNTER(MDMetaDataEditor_StructPropertiesRestored, TEXT("MDMetaDataEditor/StructPropertiesRestored"));
+
 void FMDMetaDataEditorModule::StartupModule()
 {
-	const UMDMetaDataEditorConfig* Config = GetDefault<UMDMetaDataEditorConfig>();
+	FPropertyEditorModule& PropertyEditorModule = FModuleManager::LoadModuleChecked<FPropertyEditorModule>("PropertyEditor");
+	PropertyEditorModule.RegisterCustomPropertyTypeLayout(FMDMetaDataEditorPropertyType::StaticStruct()->GetFName(), FOnGetPropertyTypeCustomizationInstance::CreateStatic(&FMDMetaDataEditorPropertyTypeCustomization::MakeInstance));
 
-	FBlueprintEditorModule& BlueprintEditorModule = FModuleManager::LoadModuleChecked<FBlueprintEditorModule>("Kismet");
+	GEditor->GetEditorSubsystem<UAssetEditorSubsystem>()->OnAssetEditorOpened().AddRaw(this, &FMDMetaDataEditorModule::OnAssetEditorOpened);
+	FCoreUObjectDelegates::ReloadCompleteDelegate.AddRaw(this, &FMDMetaDataEditorModule::OnReloadComplete);
+	FInternationalization::Get().OnCultureChanged().AddRaw(this, &FMDMetaDataEditorModule::OnCultureChanged);
+
+	ApplyConfig();
+}
 
-	if (Config->bEnableMetaDataEditorForVariables)
+void FMDMetaDataEditorModule::ShutdownModule()
+{
+	FGlobalTabmanager::Get()->UnregisterNomadTabSpawner(SMDUserStructMetaDataEditor::TabId);
+
+	UnregisterCustomizations();
+
+	if (!IsEngineExitRequested())
 	{
-		VariableCustomizationHandle = BlueprintEditorModule.RegisterVariableCustomization(FProperty::StaticClass(), FOnGetVariableCustomizationInstance::CreateStatic(&FMDMetaDataEditorVariableCustomization::MakeInstance));
+		FMDMetaDataEditorBlueprintVariableIndex::Get().Reset();
 	}
 
-	if (Config->bEnableMetaDataEditorForLocalVariables)
+	if (GEditor)
 	{
-		LocalVariableCustomizationHandle = BlueprintEditorModule.RegisterLocalVariableCustomization(FProperty::StaticClass(), FOnGetVariableCustomizationInstance::CreateStatic(&FMDMetaDataEditorVariableCustomization::MakeInstance));
+		if (UAssetEditorSubsystem* AssetEditorSubsystem = GEditor->GetEditorSubsystem<UAssetEditorSubsystem>())
+		{
+			AssetEditorSubsystem->OnAssetEditorOpened().RemoveAll(this);
+		}
 	}
 
-	if (Config->bEnableMetaDataEditorForFunctions || Config->bEnableMetaDataEditorForFunctionParameters)
+	FCoreUObjectDelegates::ReloadCompleteDelegate.RemoveAll(this);
+
+	if (FInternationalization::IsAvailable())
 	{
-		FunctionCustomizationHandle = BlueprintEditorModule.RegisterFunctionCustomization(UK2Node_FunctionEntry::StaticClass(), FOnGetFunctionCustomizationInstance::CreateStatic(&FMDMetaDataEditorFunctionCustomization::MakeInstance));
+		FInternationalization::Get().OnCultureChanged().RemoveAll(this);
 	}
 
-	if (Config->bEnableMetaDataEditorForTunnels)
+	if (FPropertyEditorModule* PropertyEditorModule = FModuleManager::GetModulePtr<FPropertyEditorModule>("PropertyEditor"))
 	{
-		TunnelCustomizationHandle = BlueprintEditorModule.RegisterFunctionCustomization(UK2Node_Tunnel::StaticClass(), FOnGetFunctionCustomizationInstance::CreateStatic(&FMDMetaDataEditorFunctionCustomization::MakeInstance));
+		PropertyEditorModule->UnregisterCustomPropertyTypeLayout(FMDMetaDataEditorPropertyType::StaticStruct()->GetFName());
 	}
 
-	if (Config->bEnableMetaDataEditorForCustomEvents || Config->bEnableMetaDataEditorForFunctionParameters)
+	StructChangeHandler.Reset();
+}
+
+void FMDMetaDataEditorModule::ApplyConfig()
+{
+	const UMDMetaDataEditorConfig* Config = GetDefault<UMDMetaDataEditorConfig>();
+
+	FBlueprintEditorModule& BlueprintEditorModule = FModuleManager::LoadModuleChecked<FBlueprintEditorModule>("Kismet");
+
+	const bool bWantsVariableCustomization = Config->bEnableMetaDataEditorForVariables;
+	if (bWantsVariableCustomization != VariableCustomizationHandle.IsValid())
 	{
-		EventCustomizationHandle = BlueprintEditorModule.RegisterFunctionCustomization(UK2Node_CustomEvent::StaticClass(), FOnGetFunctionCustomizationInstance::CreateStatic(&FMDMetaDataEditorFunctionCustomization::MakeInstance));
+		if (bWantsVariableCustomization)
+		{
+			VariableCustomizationHandle = BlueprintEditorModule.RegisterVariableCustomization(FProperty::StaticClass(), FOnGetVariableCustomizationInstance::CreateStatic(&FMDMetaDataEditorVariableCustomization::MakeInstance));
+		}
+		else
+		{
+			BlueprintEditorModule.UnregisterVariableCustomization(FProperty::StaticClass(), VariableCustomizationHandle);
+			VariableCustomizationHandle.Reset();
+		}
 	}
 
-	FPropertyEditorModule& PropertyEditorModule = FModuleManager::LoadModuleChecked<FPropertyEditorModule>("PropertyEditor");
-	PropertyEditorModule.RegisterCustomPropertyTypeLayout(FMDMetaDataEditorPropertyType::StaticStruct()->GetFName(), FOnGetPropertyTypeCustomizationInstance::CreateStatic(&FMDMetaDataEditorPropertyTypeCustomization::MakeInstance));
+	const bool bWantsLocalVariableCustomization = Config->bEnableMetaDataEditorForLocalVariables;
+	if (bWantsLocalVariableCustomization != LocalVariableCustomizationHandle.IsValid())
+	{
+		if (bWantsLocalVariableCustomization)
+		{
+			LocalVariableCustomizationHandle = BlueprintEditorModule.RegisterLocalVariableCustomization(FProperty::StaticClass(), FOnGetVariableCustomizationInstance::CreateStatic(&FMDMetaDataEditorVariableCustomization::MakeInstance));
+		}
+		else
+		{
+			BlueprintEditorModule.UnregisterLocalVariableCustomization(FProperty::StaticClass(), LocalVariableCustomizationHandle);
+			LocalVariableCustomizationHandle.Reset();
+		}
+	}
 
-	GEditor->GetEditorSubsystem<UAssetEditorSubsystem>()->OnAssetEditorOpened().AddRaw(this, &FMDMetaDataEditorModule::OnAssetEditorOpened);
+	const bool bWantsFunctionCustomization = Config->bEnableMetaDataEditorForFunctions || Config->bEnableMetaDataEditorForFunctionParameters;
+	if (bWantsFunctionCustomization != FunctionCustomizationHandle.IsValid())
+	{
+		if (bWantsFunctionCustomization)
+		{
+			FunctionCustomizationHandle = BlueprintEditorModule.RegisterFunctionCustomization(UK2Node_FunctionEntry::StaticClass(), FOnGetFunctionCustomizationInstance::CreateStatic(&FMDMetaDataEditorFunctionCustomization::MakeInstance));
+		}
+		else
+		{
+			BlueprintEditorModule.UnregisterFunctionCustomization(UK2Node_FunctionEntry::StaticClass(), FunctionCustomizationHandle);
+			FunctionCustomizationHandle.Reset();
+		}
+	}
+
+	const bool bWantsTunnelCustomization = Config->bEnableMetaDataEditorForTunnels;
+	if (bWantsTunnelCustomization != TunnelCustomizationHandle.IsValid())
+	{
+		if (bWantsTunnelCustomization)
+		{
+			TunnelCustomizationHandle = BlueprintEditorModule.RegisterFunctionCustomization(UK2Node_Tunnel::StaticClass(), FOnGetFunctionCustomizationInstance::CreateStatic(&FMDMetaDataEditorFunctionCustomization::MakeInstance));
+		}
+		else
+		{
+			BlueprintEditorModule.UnregisterFunctionCustomization(UK2Node_Tunnel::StaticClass(), TunnelCustomizationHandle);
+			TunnelCustomizationHandle.Reset();
+		}
+	}
+
+	const bool bWantsEventCustomization = Config->bEnableMetaDataEditorForCustomEvents || Config->bEnableMetaDataEditorForFunctionParameters;
+	if (bWantsEventCustomization != EventCustomizationHandle.IsValid())
+	{
+		if (bWantsEventCustomization)
+		{
+			EventCustomizationHandle = BlueprintEditorModule.RegisterFunctionCustomization(UK2Node_CustomEvent::StaticClass(), FOnGetFunctionCustomizationInstance::CreateStatic(&FMDMetaDataEditorFunctionCustomization::MakeInstance));
+		}
+		else
+		{
+			BlueprintEditorModule.UnregisterFunctionCustomization(UK2Node_CustomEvent::StaticClass(), EventCustomizationHandle);
+			EventCustomizationHandle.Reset();
+		}
+	}
 
-	if (Config->bEnableMetaDataEditorForStructs)
+	if (Config->bEnableMetaDataEditorForStructs != StructChangeHandler.IsValid())
 	{
-		StructChangeHandler = MakeShared<FMDMetaDataEditorStructChangeHandler>();
+		if (Config->bEnableMetaDataEditorForStructs)
+		{
+			StructChangeHandler = MakeShared<FMDMetaDataEditorStructChangeHandler>();
+		}
+		else
+		{
+			StructChangeHandler.Reset();
+		}
 	}
 }
 
-void FMDMetaDataEditorModule::ShutdownModule()
+void FMDMetaDataEditorModule::UnregisterCustomizations()
 {
-	FGlobalTabmanager::Get()->UnregisterNomadTabSpawner(SMDUserStructMetaDataEditor::TabId);
-
 	// These StaticClasses aren't valid during engine shutdown, gate the unregistration similarly to the logic in FRigVMEditorModule::ShutdownModule()
 	if (!IsEngineExitRequested())
 	{
@@ -76,26 +195,23 @@ void FMDMetaDataEditorModule::ShutdownModule()
 		}
 	}
 
-	if (GEditor)
-	{
-		if (UAssetEditorSubsystem* AssetEditorSubsystem = GEditor->GetEditorSubsystem<UAssetEditorSubsystem>())
-		{
-			AssetEditorSubsystem->OnAssetEditorOpened().RemoveAll(this);
-		}
-	}
-
-	if (FPropertyEditorModule* PropertyEditorModule = FModuleManager::GetModulePtr<FPropertyEditorModule>("PropertyEditor"))
-	{
-		PropertyEditorModule->UnregisterCustomPropertyTypeLayout(FMDMetaDataEditorPropertyType::StaticStruct()->GetFName());
-	}
+	VariableCustomizationHandle.Reset();
+	LocalVariableCustomizationHandle.Reset();
+	FunctionCustomizationHandle.Reset();
+	TunnelCustomizationHandle.Reset();
+	EventCustomizationHandle.Reset();
+}
 
-	StructChangeHandler.Reset();
+void FMDMetaDataEditorModule::OnReloadComplete(EReloadCompleteReason Reason)
+{
+	// Supported Blueprint classes are cached as resolved pointers, which may have been replaced by the reload
+	GetMutableDefault<UMDMetaDataEditorConfig>()->RebuildKeyIndex();
 }
 
-void FMDMetaDataEditorModule::RestartModule()
+void FMDMetaDataEditorModule::OnCultureChanged()
 {
-	ShutdownModule();
-	StartupModule();
+	// The filter and tool tip text are built from strings, so a localized DisplayNameOverride doesn't update them on its own
+	GetDefault<UMDMetaDataEditorConfig>()->ResetCachedKeyText();
 }
 
 void FMDMetaDataEditorModule::OnAssetEditorOpened(UObject* Asset)
@@ -3,10 +3,14 @@
 #pragma once
 
 #include "Delegates/IDelegateInstance.h"
+#include "Logging/LogMacros.h"
 #include "Modules/ModuleInterface.h"
 #include "Templates/SharedPointer.h"
 
+DECLARE_LOG_CATEGORY_EXTERN(LogMDMetaDataEditor, Log, All);
+
 class FMDMetaDataEditorStructChangeHandler;
+enum class EReloadCompleteReason;
 
 class FMDMetaDataEditorModule : public IModuleInterface
 {
@@ -15,10 +19,15 @@ public:
 	virtual void StartupModule() override;
 	virtual void ShutdownModule() override;
 
-	void RestartModule();
+	// Registers or unregisters each customization to match the current config, leaving unchanged ones in place
+	void ApplyConfig();
 
 private:
 	void OnAssetEditorOpened(UObject* Asset);
+	void OnReloadComplete(EReloadCompleteReason Reason);
+	void OnCultureChanged();
+
+	void UnregisterCustomizations();
 
 	TSharedPtr<FMDMetaDataEditorStructChangeHandler> StructChangeHandler;
 
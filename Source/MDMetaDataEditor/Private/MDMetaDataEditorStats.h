@@ -0,0 +1,43 @@
+// Copyright Dylan Dumesnil. All Rights Reserved.
+
+#pragma once
+
+#include "ProfilingDebugging/CountersTrace.h"
+#include "ProfilingDebugging/CpuProfilerTrace.h"
+#include "Stats/Stats.h"
+#include "Trace/Trace.h"
+
+// Run with -trace=cpu,MDMetaDataEditor to see the meta data editor's scopes in Unreal Insights
+UE_TRACE_CHANNEL_EXTERN(MDMetaDataEditorChannel);
+
+DECLARE_STATS_GROUP(TEXT("MDMetaDataEditor"), STATGROUP_MDMetaDataEditor, STATCAT_Advanced);
+
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Build Key Index"), STAT_MDMetaDataEditor_BuildKeyIndex, STATGROUP_MDMetaDataEditor, );
+DECLARE_CYCLE_STAT_EXTERN(TEXT("ForEach Meta Data Key"), STAT_MDMetaDataEditor_ForEachMetaDataKey, STATGROUP_MDMetaDataEditor, );
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Generate Meta Data Editor"), STAT_MDMetaDataEditor_GenerateMetadataEditor, STATGROUP_MDMetaDataEditor, );
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Add Meta Data Value Editor"), STAT_MDMetaDataEditor_AddMetadataValueEditor, STATGROUP_MDMetaDataEditor, );
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Add Raw Meta Data Editor"), STAT_MDMetaDataEditor_AddRawMetadataEditor, STATGROUP_MDMetaDataEditor, );
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Finish Meta Data Changes"), STAT_MDMetaDataEditor_FinishMetadataChanges, STATGROUP_MDMetaDataEditor, );
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Refresh Details"), STAT_MDMetaDataEditor_RefreshDetails, STATGROUP_MDMetaDataEditor, );
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Struct Pre Change"), STAT_MDMetaDataEditor_StructPreChange, STATGROUP_MDMetaDataEditor, );
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Struct Post Change"), STAT_MDMetaDataEditor_StructPostChange, STATGROUP_MDMetaDataEditor, );
+
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Keys Evaluated"), STAT_MDMetaDataEditor_KeysEvaluated, STATGROUP_MDMetaDataEditor, );
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Keys Matched"), STAT_MDMetaDataEditor_KeysMatched, STATGROUP_MDMetaDataEditor, );
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Rows Built"), STAT_MDMetaDataEditor_RowsBuilt, STATGROUP_MDMetaDataEditor, );
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Struct Properties Restored"), STAT_MDMetaDataEditor_StructPropertiesRestored, STATGROUP_MDMetaDataEditor, );
+
+TRACE_DECLARE_INT_COUNTER_EXTERN(MDMetaDataEditor_KeysEvaluated);
+TRACE_DECLARE_INT_COUNTER_EXTERN(MDMetaDataEditor_KeysMatched);
+TRACE_DECLARE_INT_COUNTER_EXTERN(MDMetaDataEditor_RowsBuilt);
+TRACE_DECLARE_INT_COUNTER_EXTERN(MDMetaDataEditor_StructPropertiesRestored);
+
+// Times the scope as both a stat and an Insights event on the meta data editor's trace channel
+#define MDMDE_SCOPE_CYCLE_COUNTER(Stat) \
+	SCOPE_CYCLE_COUNTER(Stat); \
+	TRACE_CPUPROFILER_EVENT_SCOPE_ON_CHANNEL(Stat, MDMetaDataEditorChannel)
+
+// Adds to both the per-frame stat counter and the Insights counter
+#define MDMDE_INC_COUNTER(Counter, Amount) \
+	INC_DWORD_STAT_BY(STAT_##Counter, Amount); \
+	TRACE_COUNTER_ADD(Counter, Amount)
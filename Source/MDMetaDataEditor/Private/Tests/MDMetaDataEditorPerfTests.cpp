@@ -0,0 +1,131 @@
+// Copyright Dylan Dumesnil. All Rights Reserved.
+
+#include "Misc/AutomationTest.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "Commandlets/MDMetaDataEditorBenchmark.h"
+#include "Interfaces/IPluginManager.h"
+#include "Misc/ConfigCacheIni.h"
+#include "Misc/Paths.h"
+
+namespace MDMDEPT_Private
+{
+	// The fastest sample is compared, a few samples keeps one-off hitches from failing the test
+	constexpr int32 NumIterations = 3;
+
+	const TCHAR* const ConfigSection = TEXT("MDMetaDataEditor.Perf");
+
+	struct FPerfSettings
+	{
+		FString BaselinePath;
+		double TimeMargin = 0.25;
+		double MemoryMargin = 0.5;
+	};
+
+	// The baseline is checked in with the plugin, a project can point at its own or loosen the margins (eg. for slower build machines) in its editor config:
+	// [MDMetaDataEditor.Perf]
+	// Baseline=<Path relative to the project>
+	// TimeMargin=0.25
+	// MemoryMargin=0.5
+	FPerfSettings LoadPerfSettings()
+	{
+		FPerfSettings Settings;
+		if (GConfig->GetString(ConfigSection, TEXT("Baseline"), Settings.BaselinePath, GEditorIni) && !Settings.BaselinePath.IsEmpty())
+		{
+			Settings.BaselinePath = FPaths::ConvertRelativePathToFull(FPaths::ProjectDir(), Settings.BaselinePath);
+		}
+		else if (const TSharedPtr<IPlugin> Plugin = IPluginManager::Get().FindPlugin(TEXT("MDMetaDataEditor")))
+		{
+			Settings.BaselinePath = Plugin->GetBaseDir() / TEXT("Config") / TEXT("PerfBaseline.csv");
+		}
+
+		GConfig->GetDouble(ConfigSection, TEXT("TimeMargin"), Settings.TimeMargin, GEditorIni);
+		GConfig->GetDouble(ConfigSection, TEXT("MemoryMargin"), Settings.MemoryMargin, GEditorIni);
+
+		return Settings;
+	}
+
+	bool CheckBudget(FAutomationTestBase& Test, const FMDMetaDataEditorBenchmarkScenario& Scenario, const FMDMetaDataEditorBenchmarkResult& Result)
+	{
+		const FPerfSettings Settings = LoadPerfSettings();
+
+		TMap<FString, FMDMetaDataEditorBenchmarkBaselineEntry> Baseline;
+		if (!FMDMetaDataEditorBenchmark::ReadBaseline(Settings.BaselinePath, Scenario, Baseline))
+		{
+			Test.AddError(FString::Printf(TEXT("Failed to read perf baseline [%s]"), *Settings.BaselinePath));
+			return false;
+		}
+
+		Test.AddInfo(FString::Printf(TEXT("%s: %lld item(s), min %.3f ms, %lld KB allocated"), *Result.Name, Result.NumItems, Result.GetMinSeconds() * 1000.0, Result.AllocatedBytes / 1024));
+
+		// A missing entry fails too, otherwise a baseline that was never recorded would silently disable the budget
+		const FMDMetaDataEditorBenchmarkBaselineEntry* Entry = Baseline.Find(Result.Name);
+		if (Entry == nullptr)
+		{
+			Test.AddError(FString::Printf(TEXT("Perf baseline [%s] has no entry for %s at this scenario size, record one with: -run=MDMetaDataEditorBenchmark -Perf -Output=<Baseline>"), *Settings.BaselinePath, *Result.Name));
+			return false;
+		}
+
+		TArray<FString> Errors;
+		if (!FMDMetaDataEditorBenchmark::IsWithinBudget(Result, *Entry, Settings.TimeMargin, Settings.MemoryMargin, Errors))
+		{
+			for (const FString& Error : Errors)
+			{
+				Test.AddError(Error);
+			}
+
+			return false;
+		}
+
+		return true;
+	}
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FMDMetaDataEditorPerfKeyEnumerationTest, "MDMetaDataEditor.Perf.KeyEnumeration1000Vars500Keys", EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FMDMetaDataEditorPerfKeyEnumerationTest::RunTest(const FString& Parameters)
+{
+	FMDMetaDataEditorBenchmark Benchmark(FMDMetaDataEditorBenchmarkScenario::MakePerf());
+	Benchmark.GenerateBlueprints();
+	if (!TestTrue(TEXT("Generated the perf Blueprint"), Benchmark.HasBlueprints()))
+	{
+		return false;
+	}
+
+	FMDMetaDataEditorBenchmarkResult Result = { TEXT("KeyEnumeration") };
+	for (int32 Iteration = 0; Iteration < MDMDEPT_Private::NumIterations; ++Iteration)
+	{
+		FMDMetaDataEditorBenchmark::Measure(Result, [&Benchmark]()
+		{
+			return Benchmark.EnumerateKeys();
+		});
+	}
+
+	return MDMDEPT_Private::CheckBudget(*this, Benchmark.GetScenario(), Result);
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FMDMetaDataEditorPerfCompileTest, "MDMetaDataEditor.Perf.Compile200Functions", EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FMDMetaDataEditorPerfCompileTest::RunTest(const FString& Parameters)
+{
+	FMDMetaDataEditorBenchmark Benchmark(FMDMetaDataEditorBenchmarkScenario::MakePerf());
+	Benchmark.GenerateBlueprints();
+	if (!TestTrue(TEXT("Generated the perf Blueprint"), Benchmark.HasBlueprints()))
+	{
+		return false;
+	}
+
+	FMDMetaDataEditorBenchmarkResult Result = { TEXT("CompileBlueprints") };
+	for (int32 Iteration = 0; Iteration < MDMDEPT_Private::NumIterations; ++Iteration)
+	{
+		FMDMetaDataEditorBenchmark::Measure(Result, [&Benchmark]()
+		{
+			return Benchmark.CompileBlueprints();
+		});
+	}
+
+	return MDMDEPT_Private::CheckBudget(*this, Benchmark.GetScenario(), Result);
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
@@ -130,6 +130,47 @@ void FMDMetaDataEditorPropertyType::SetFromGraphTerminalType(const FEdGraphTermi
 	PropertySubTypeObject = GraphTerminalType.TerminalSubCategoryObject.Get();
 }
 
+FMDMetaDataEditorPropertyQuery::FMDMetaDataEditorPropertyQuery(const FProperty* InProperty)
+	: Property(InProperty)
+	, ElementProperty(InProperty)
+{
+	if (Property == nullptr)
+	{
+		return;
+	}
+
+	if (const FArrayProperty* ArrayProperty = CastField<FArrayProperty>(Property))
+	{
+		ContainerType = EMDMetaDataPropertyContainerType::Array;
+		ElementProperty = ArrayProperty->Inner;
+	}
+	else if (const FSetProperty* SetProperty = CastField<FSetProperty>(Property))
+	{
+		ContainerType = EMDMetaDataPropertyContainerType::Set;
+		ElementProperty = SetProperty->ElementProp;
+	}
+	else if (const FMapProperty* MapProperty = CastField<FMapProperty>(Property))
+	{
+		ContainerType = EMDMetaDataPropertyContainerType::Map;
+		ElementProperty = MapProperty->KeyProp;
+	}
+
+	if (const FEnumProperty* EnumProperty = CastField<FEnumProperty>(Property))
+	{
+		Enum = EnumProperty->GetEnum();
+	}
+	else if (const FByteProperty* ByteProperty = CastField<FByteProperty>(Property))
+	{
+		Enum = ByteProperty->Enum;
+	}
+
+	if (ElementProperty != nullptr)
+	{
+		const UEdGraphSchema_K2* K2Schema = GetDefault<UEdGraphSchema_K2>();
+		bHasElementPinType = K2Schema->ConvertPropertyToPinType(ElementProperty, ElementPinType);
+	}
+}
+
 bool FMDMetaDataEditorPropertyType::DoesMatchProperty(const FProperty* Property) const
 {
 	if (Property == nullptr)
@@ -137,31 +178,34 @@ bool FMDMetaDataEditorPropertyType::DoesMatchProperty(const FProperty* Property)
 		return false;
 	}
 
-	const FProperty* EffectiveProp = Property;
+	return DoesMatchQuery(FMDMetaDataEditorPropertyQuery(Property));
+}
 
-	if (ContainerType == EMDMetaDataPropertyContainerType::Array || Property->IsA<FArrayProperty>())
+bool FMDMetaDataEditorPropertyType::DoesMatchQuery(const FMDMetaDataEditorPropertyQuery& Query) const
+{
+	if (Query.Property == nullptr)
 	{
-		const FArrayProperty* ArrayProperty = CastField<FArrayProperty>(Property);
-		if (ArrayProperty == nullptr)
+		return false;
+	}
+
+	// Arrays are checked first, so any container type will match against the array's inner property
+	if (ContainerType == EMDMetaDataPropertyContainerType::Array || Query.ContainerType == EMDMetaDataPropertyContainerType::Array)
+	{
+		if (Query.ContainerType != EMDMetaDataPropertyContainerType::Array)
 		{
 			return false;
 		}
-
-		EffectiveProp = ArrayProperty->Inner;
 	}
-	else if (ContainerType == EMDMetaDataPropertyContainerType::Set || Property->IsA<FSetProperty>())
+	else if (ContainerType == EMDMetaDataPropertyContainerType::Set || Query.ContainerType == EMDMetaDataPropertyContainerType::Set)
 	{
-		const FSetProperty* SetProperty = CastField<FSetProperty>(Property);
-		if (SetProperty == nullptr)
+		if (Query.ContainerType != EMDMetaDataPropertyContainerType::Set)
 		{
 			return false;
 		}
-
-		EffectiveProp = SetProperty->ElementProp;
 	}
-	else if (ContainerType == EMDMetaDataPropertyContainerType::Map || Property->IsA<FMapProperty>())
+	else if (ContainerType == EMDMetaDataPropertyContainerType::Map || Query.ContainerType == EMDMetaDataPropertyContainerType::Map)
 	{
-		const FMapProperty* MapProperty = CastField<FMapProperty>(Property);
+		const FMapProperty* MapProperty = CastField<FMapProperty>(Query.Property);
 		if (MapProperty == nullptr)
 		{
 			return false;
@@ -176,8 +220,12 @@ bool FMDMetaDataEditorPropertyType::DoesMatchProperty(const FProperty* Property)
 				return false;
 			}
 		}
+	}
 
-		EffectiveProp = MapProperty->KeyProp;
+	const FProperty* EffectiveProp = Query.ElementProperty;
+	if (EffectiveProp == nullptr)
+	{
+		return false;
 	}
 
 	if (PropertyType == UEdGraphSchema_K2::PC_Wildcard)
@@ -244,35 +292,20 @@ bool FMDMetaDataEditorPropertyType::DoesMatchProperty(const FProperty* Property)
 
 	if (PropertyType == UEdGraphSchema_K2::PC_Enum || (PropertyType == UEdGraphSchema_K2::PC_Byte && PropertySubTypeObject.IsValid()))
 	{
-		const UEnum* PropertyEnum = [Property]() -> const UEnum*
-		{
-			if (const FEnumProperty* EnumProperty = CastField<FEnumProperty>(Property))
-			{
-				return EnumProperty->GetEnum();
-			}
-			else if (const FByteProperty* ByteProperty = CastField<FByteProperty>(Property))
-			{
-				return ByteProperty->Enum;
-			}
-
-			return nullptr;
-		}();
-
-		if (!IsValid(PropertyEnum))
+		if (!IsValid(Query.Enum))
 		{
 			return false;
 		}
 
-		return PropertySubTypeObject == UEnum::StaticClass() || PropertySubTypeObject == PropertyEnum;
+		return PropertySubTypeObject == UEnum::StaticClass() || PropertySubTypeObject == Query.Enum;
 	}
 
-	const UEdGraphSchema_K2* K2Schema = GetDefault<UEdGraphSchema_K2>();
-	FEdGraphPinType PinType;
-	if (!K2Schema->ConvertPropertyToPinType(EffectiveProp, PinType))
+	if (!Query.bHasElementPinType)
 	{
 		return false;
 	}
 
+	const FEdGraphPinType& PinType = Query.ElementPinType;
 	return PropertyType == PinType.PinCategory
 		&& PropertySubType == PinType.PinSubCategory
 		&& PropertySubTypeObject.Get() == PinType.PinSubCategoryObject
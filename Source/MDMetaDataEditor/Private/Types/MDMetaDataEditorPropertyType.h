@@ -13,6 +13,7 @@
 
 struct FEdGraphPinType;
 struct FEdGraphTerminalType;
+class UEnum;
 
 UENUM()
 enum class EMDMetaDataPropertyContainerType : uint8
@@ -23,6 +24,29 @@ enum class EMDMetaDataPropertyContainerType : uint8
 	Map
 };
 
+/**
+ * The parts of a property that property types are matched against.
+ * Gathered once so the same property can be tested against many property types without converting it to a pin type each time.
+ */
+struct FMDMetaDataEditorPropertyQuery
+{
+	explicit FMDMetaDataEditorPropertyQuery(const FProperty* InProperty);
+
+	const FProperty* Property = nullptr;
+
+	// The array inner, set element or map key property, or Property itself if it isn't a container
+	const FProperty* ElementProperty = nullptr;
+
+	EMDMetaDataPropertyContainerType ContainerType = EMDMetaDataPropertyContainerType::None;
+
+	// The enum of Property if it's an enum or enum-backed byte property
+	const UEnum* Enum = nullptr;
+
+	// The pin type of ElementProperty, only valid if bHasElementPinType is true
+	FEdGraphPinType ElementPinType;
+	bool bHasElementPinType = false;
+};
+
 USTRUCT()
 struct FMDMetaDataEditorPropertyType
 {
@@ -47,6 +71,7 @@ public:
 	void SetFromGraphTerminalType(const FEdGraphTerminalType& GraphTerminalType);
 
 	bool DoesMatchProperty(const FProperty* Property) const;
+	bool DoesMatchQuery(const FMDMetaDataEditorPropertyQuery& Query) const;
 
 	UPROPERTY(EditAnywhere, Config, Category = "Meta Data Editor")
 	FName PropertyType = NAME_None;
@@ -9,9 +9,14 @@ bool FMDMetaDataKey::DoesSupportBlueprint(const UBlueprint* Blueprint) const
 		return false;
 	}
 
-	for (const TSoftClassPtr<UBlueprint>& BPClass : SupportedBlueprints)
+	if (!bHasResolvedSupportedBlueprints || bHasUnresolvedSupportedBlueprints)
 	{
-		if (Blueprint->IsA(BPClass.Get()))
+		ResolveSupportedBlueprints();
+	}
+
+	for (const UClass* BPClass : ResolvedSupportedBlueprints)
+	{
+		if (Blueprint->IsA(BPClass))
 		{
 			return true;
 		}
@@ -20,6 +25,33 @@ bool FMDMetaDataKey::DoesSupportBlueprint(const UBlueprint* Blueprint) const
 	return false;
 }
 
+void FMDMetaDataKey::ResolveSupportedBlueprints() const
+{
+	ResolvedSupportedBlueprints.Reset(SupportedBlueprints.Num());
+	bHasUnresolvedSupportedBlueprints = false;
+
+	for (const TSoftClassPtr<UBlueprint>& BPClass : SupportedBlueprints)
+	{
+		if (const UClass* Class = BPClass.Get())
+		{
+			ResolvedSupportedBlueprints.AddUnique(Class);
+		}
+		else if (!BPClass.IsNull())
+		{
+			bHasUnresolvedSupportedBlueprints = true;
+		}
+	}
+
+	bHasResolvedSupportedBlueprints = true;
+}
+
+void FMDMetaDataKey::ResetResolvedSupportedBlueprints() const
+{
+	ResolvedSupportedBlueprints.Reset();
+	bHasResolvedSupportedBlueprints = false;
+	bHasUnresolvedSupportedBlueprints = false;
+}
+
 bool FMDMetaDataKey::DoesSupportProperty(const FProperty* Property) const
 {
 	if (Property == nullptr)
@@ -27,9 +59,10 @@ bool FMDMetaDataKey::DoesSupportProperty(const FProperty* Property) const
 		return false;
 	}
 
+	const FMDMetaDataEditorPropertyQuery Query(Property);
 	for (const FMDMetaDataEditorPropertyType& PropertyType : SupportedPropertyTypes)
 	{
-		if (PropertyType.DoesMatchProperty(Property))
+		if (PropertyType.DoesMatchQuery(Query))
 		{
 			return true;
 		}
@@ -38,36 +71,63 @@ bool FMDMetaDataKey::DoesSupportProperty(const FProperty* Property) const
 	return false;
 }
 
-FText FMDMetaDataKey::GetKeyDisplayText() const
+const FText& FMDMetaDataKey::GetKeyDisplayText() const
 {
+	CacheText();
+	return CachedDisplayText;
+}
+
+const FText& FMDMetaDataKey::GetToolTipText() const
+{
+	CacheText();
+	return CachedToolTipText;
+}
+
+const FText& FMDMetaDataKey::GetFilterText() const
+{
+	CacheText();
+	return CachedFilterText;
+}
+
+void FMDMetaDataKey::CacheText() const
+{
+	if (bHasCachedText)
+	{
+		return;
+	}
+
+	bHasCachedText = true;
+
 	if (bUseDisplayNameOverride)
 	{
-		return DisplayNameOverride;
+		CachedDisplayText = DisplayNameOverride;
 	}
 	else
 	{
-		return FText::FromString(FName::NameToDisplayString(Key.ToString(), false));
+		CachedDisplayText = FText::FromString(FName::NameToDisplayString(Key.ToString(), false));
 	}
-}
 
-FText FMDMetaDataKey::GetToolTipText() const
-{
 	FString ToolTip = Description;
 	if (bUseDisplayNameOverride)
 	{
 		ToolTip += "\r\n\r\nMeta Data Key: \"" + Key.ToString() + "\"";
 	}
-	return FText::FromString(ToolTip);
-}
+	CachedToolTipText = FText::FromString(ToolTip);
 
-FText FMDMetaDataKey::GetFilterText() const
-{
 	FString Filter = Key.ToString();
 	if (bUseDisplayNameOverride)
 	{
 		Filter += TEXT(" ") + DisplayNameOverride.ToString();
 	}
-	return FText::FromString(Filter);
+	CachedFilterText = FText::FromString(Filter);
+}
+
+void FMDMetaDataKey::ResetCachedText() const
+{
+	CachedDisplayText = FText::GetEmpty();
+	CachedToolTipText = FText::GetEmpty();
+	CachedFilterText = FText::GetEmpty();
+	bHasCachedText = false;
 }
 
 bool FMDMetaDataKey::operator==(const FMDMetaDataKey& Other) const
@@ -179,6 +179,13 @@ public:
 	bool DoesSupportBlueprint(const UBlueprint* Blueprint) const;
 	bool DoesSupportProperty(const FProperty* Property) const;
 
+	// Resolves SupportedBlueprints to class pointers, classes that aren't loaded yet are retried on the next call
+	void ResolveSupportedBlueprints() const;
+	// Must be called if SupportedBlueprints changes or the resolved classes may have been replaced (eg. hot reload)
+	void ResetResolvedSupportedBlueprints() const;
+	const TArray<const UClass*>& GetResolvedSupportedBlueprints() const { return ResolvedSupportedBlueprints; }
+	bool HasUnresolvedSupportedBlueprints() const { return bHasUnresolvedSupportedBlueprints; }
+
 	// Overrides the User friendly name to show for this key if not empty.
 	UPROPERTY(EditAnywhere, Config, Category = "Meta Data Editor", meta = (InlineEditConditionToggle))
 	bool bUseDisplayNameOverride = false;
@@ -188,9 +195,15 @@ public:
 	FText DisplayNameOverride;
 	FMDMetaDataKey& SetDisplayNameOverride(FText&& InDisplayNameOverride) { bUseDisplayNameOverride = true; DisplayNameOverride = MoveTemp(InDisplayNameOverride); return *this; }
 
-	FText GetKeyDisplayText() const;
-	FText GetToolTipText() const;
-	FText GetFilterText() const;
+	// Built once and cached, see CacheText
+	const FText& GetKeyDisplayText() const;
+	const FText& GetToolTipText() const;
+	const FText& GetFilterText() const;
+
+	// Builds the display, tool tip and filter text, they're rebuilt on the next Get call after ResetCachedText
+	void CacheText() const;
+	// Must be called if Key, Description or DisplayNameOverride change, or the culture changes
+	void ResetCachedText() const;
 
 	bool operator==(const FMDMetaDataKey& Other) const;
 	bool operator!=(const FMDMetaDataKey& Other) const
@@ -202,4 +215,14 @@ public:
 	{
 		return HashCombine(GetTypeHash(MetaDataKey.Key), GetTypeHash(MetaDataKey.KeyType));
 	}
+
+private:
+	mutable TArray<const UClass*> ResolvedSupportedBlueprints;
+	mutable bool bHasResolvedSupportedBlueprints = false;
+	mutable bool bHasUnresolvedSupportedBlueprints = false;
+
+	mutable FText CachedDisplayText;
+	mutable FText CachedToolTipText;
+	mutable FText CachedFilterText;
+	mutable bool bHasCachedText = false;
 };
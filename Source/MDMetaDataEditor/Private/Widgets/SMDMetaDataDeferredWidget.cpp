@@ -0,0 +1,24 @@
+// Copyright Dylan Dumesnil. All Rights Reserved.
+
+#include "SMDMetaDataDeferredWidget.h"
+
+void SMDMetaDataDeferredWidget::Construct(const FArguments& InArgs)
+{
+	OnGenerateContent = InArgs._OnGenerateContent;
+}
+
+void SMDMetaDataDeferredWidget::Tick(const FGeometry& AllottedGeometry, const double InCurrentTime, const float InDeltaTime)
+{
+	SCompoundWidget::Tick(AllottedGeometry, InCurrentTime, InDeltaTime);
+
+	if (OnGenerateContent.IsBound())
+	{
+		ChildSlot
+		[
+			OnGenerateContent.Execute()
+		];
+
+		OnGenerateContent.Unbind();
+		SetCanTick(false);
+	}
+}
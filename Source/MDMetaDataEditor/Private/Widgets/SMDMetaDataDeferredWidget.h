@@ -0,0 +1,24 @@
+// Copyright Dylan Dumesnil. All Rights Reserved.
+
+#pragma once
+
+#include "Widgets/SCompoundWidget.h"
+
+// Generates its content the first time it ticks, which only happens once it's visible (eg. its details group gets expanded)
+class SMDMetaDataDeferredWidget : public SCompoundWidget
+{
+public:
+	DECLARE_DELEGATE_RetVal(TSharedRef<SWidget>, FOnGenerateContent);
+
+	SLATE_BEGIN_ARGS(SMDMetaDataDeferredWidget)
+	{}
+		SLATE_EVENT(FOnGenerateContent, OnGenerateContent);
+	SLATE_END_ARGS()
+
+	void Construct(const FArguments& InArgs);
+
+	virtual void Tick(const FGeometry& AllottedGeometry, const double InCurrentTime, const float InDeltaTime) override;
+
+private:
+	FOnGenerateContent OnGenerateContent;
+};
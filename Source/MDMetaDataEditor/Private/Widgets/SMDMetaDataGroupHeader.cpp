@@ -0,0 +1,35 @@
+// Copyright Dylan Dumesnil. All Rights Reserved.
+
+#include "SMDMetaDataGroupHeader.h"
+
+#include "Config/MDMetaDataEditorUserConfig.h"
+#include "DetailLayoutBuilder.h"
+#include "IDetailGroup.h"
+#include "Widgets/Text/STextBlock.h"
+
+void SMDMetaDataGroupHeader::Construct(const FArguments& InArgs, IDetailGroup& InGroup)
+{
+	Group = &InGroup;
+	ExpansionPath = InArgs._ExpansionPath;
+	bWasExpanded = InArgs._IsExpanded;
+
+	ChildSlot
+	[
+		SNew(STextBlock)
+		.Font(IDetailLayoutBuilder::GetDetailFont())
+		.Text(InArgs._DisplayName)
+	];
+}
+
+void SMDMetaDataGroupHeader::Tick(const FGeometry& AllottedGeometry, const double InCurrentTime, const float InDeltaTime)
+{
+	SCompoundWidget::Tick(AllottedGeometry, InCurrentTime, InDeltaTime);
+
+	// The details panel doesn't expose group expansion events, so poll while the header is visible
+	const bool bIsExpanded = Group->GetExpansionState();
+	if (bIsExpanded != bWasExpanded)
+	{
+		bWasExpanded = bIsExpanded;
+		GetMutableDefault<UMDMetaDataEditorUserConfig>()->SetMetaDataGroupExpanded(ExpansionPath, bIsExpanded);
+	}
+}
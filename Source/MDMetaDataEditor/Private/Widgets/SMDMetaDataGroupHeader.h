@@ -0,0 +1,31 @@
+// Copyright Dylan Dumesnil. All Rights Reserved.
+
+#pragma once
+
+#include "Widgets/SCompoundWidget.h"
+
+class IDetailGroup;
+
+// Header for a meta data details group that remembers whether the user left the group expanded
+class SMDMetaDataGroupHeader : public SCompoundWidget
+{
+public:
+	SLATE_BEGIN_ARGS(SMDMetaDataGroupHeader)
+	{}
+		SLATE_ARGUMENT(FText, DisplayName);
+		// The path the expansion state is saved under in the user config
+		SLATE_ARGUMENT(FString, ExpansionPath);
+		// The expansion state the group was created with, the group can't be queried until the details panel has built its tree
+		SLATE_ARGUMENT_DEFAULT(bool, IsExpanded) = false;
+	SLATE_END_ARGS()
+
+	// Group must own this header, the details panel discards the header row's widget before the group
+	void Construct(const FArguments& InArgs, IDetailGroup& InGroup);
+
+	virtual void Tick(const FGeometry& AllottedGeometry, const double InCurrentTime, const float InDeltaTime) override;
+
+private:
+	IDetailGroup* Group = nullptr;
+	FString ExpansionPath;
+	bool bWasExpanded = false;
+};
@@ -0,0 +1,308 @@
+// Copyright Dylan Dumesnil. All Rights Reserved.
+
+#include "SMDMetaDataRawEditor.h"
+
+#include "DetailLayoutBuilder.h"
+#include "Styling/AppStyle.h"
+#include "Widgets/Images/SImage.h"
+#include "Widgets/Input/SButton.h"
+#include "Widgets/Input/SEditableTextBox.h"
+#include "Widgets/Input/SSearchBox.h"
+#include "Widgets/Layout/SBox.h"
+#include "Widgets/SBoxPanel.h"
+#include "Widgets/Text/STextBlock.h"
+#include "Widgets/Views/STableRow.h"
+
+const FName SMDMetaDataRawEditor::KeyColumnId = TEXT("Key");
+const FName SMDMetaDataRawEditor::ValueColumnId = TEXT("Value");
+const FName SMDMetaDataRawEditor::RemoveColumnId = TEXT("Remove");
+
+namespace MDMDERE_Private
+{
+	// Tall enough for ~12 rows, the list scrolls past that instead of growing the details panel
+	constexpr float MaxListHeight = 300.f;
+
+	class SRawEntryRow : public SMultiColumnTableRow<TSharedPtr<FMDMetaDataRawEntry>>
+	{
+	public:
+		SLATE_BEGIN_ARGS(SRawEntryRow)
+		{}
+			SLATE_ARGUMENT_DEFAULT(bool, IsReadOnly) = false;
+			SLATE_EVENT(SMDMetaDataRawEditor::FOnMetaDataTextCommitted, OnKeyCommitted);
+			SLATE_EVENT(SMDMetaDataRawEditor::FOnMetaDataTextCommitted, OnValueCommitted);
+			SLATE_EVENT(SMDMetaDataRawEditor::FOnRemoveMetaData, OnRemoveMetaData);
+		SLATE_END_ARGS()
+
+		void Construct(const FArguments& InArgs, const TSharedRef<STableViewBase>& OwnerTable, TSharedPtr<FMDMetaDataRawEntry> InEntry)
+		{
+			Entry = InEntry;
+			bIsReadOnly = InArgs._IsReadOnly;
+			OnKeyCommitted = InArgs._OnKeyCommitted;
+			OnValueCommitted = InArgs._OnValueCommitted;
+			OnRemoveMetaData = InArgs._OnRemoveMetaData;
+
+			SMultiColumnTableRow<TSharedPtr<FMDMetaDataRawEntry>>::Construct(FSuperRowType::FArguments(), OwnerTable);
+		}
+
+		virtual TSharedRef<SWidget> GenerateWidgetForColumn(const FName& ColumnName) override
+		{
+			if (ColumnName == SMDMetaDataRawEditor::KeyColumnId)
+			{
+				return SNew(SEditableTextBox)
+					.Font(IDetailLayoutBuilder::GetDetailFont())
+					.IsReadOnly(bIsReadOnly)
+					.Text(Entry->KeyText)
+					.OnTextCommitted(this, &SRawEntryRow::OnTextCommitted, true)
+					.RevertTextOnEscape(true);
+			}
+			else if (ColumnName == SMDMetaDataRawEditor::ValueColumnId)
+			{
+				return SNew(SEditableTextBox)
+					.Font(IDetailLayoutBuilder::GetDetailFont())
+					.IsReadOnly(bIsReadOnly)
+					.Text(Entry->ValueText)
+					.ToolTipText(Entry->ValueText)
+					.OnTextCommitted(this, &SRawEntryRow::OnTextCommitted, false)
+					.RevertTextOnEscape(true);
+			}
+			else if (ColumnName == SMDMetaDataRawEditor::RemoveColumnId && !bIsReadOnly)
+			{
+				return SNew(SButton)
+					.IsFocusable(false)
+					.ToolTipText(INVTEXT("Remove this meta data"))
+					.ButtonStyle(FAppStyle::Get(), "SimpleButton")
+					.ContentPadding(0)
+					.OnClicked(this, &SRawEntryRow::OnRemoveClicked)
+					.Content()
+					[
+						SNew(SImage)
+						.Image(FAppStyle::GetBrush("Icons.X"))
+						.ColorAndOpacity(FSlateColor::UseForeground())
+					];
+			}
+
+			return SNullWidget::NullWidget;
+		}
+
+	private:
+		void OnTextCommitted(const FText& NewText, ETextCommit::Type InTextCommit, bool bIsKey)
+		{
+			const SMDMetaDataRawEditor::FOnMetaDataTextCommitted& OnCommitted = bIsKey ? OnKeyCommitted : OnValueCommitted;
+			OnCommitted.ExecuteIfBound(NewText, InTextCommit, Entry->Key);
+		}
+
+		FReply OnRemoveClicked()
+		{
+			return OnRemoveMetaData.IsBound() ? OnRemoveMetaData.Execute(Entry->Key) : FReply::Unhandled();
+		}
+
+		TSharedPtr<FMDMetaDataRawEntry> Entry;
+		bool bIsReadOnly = false;
+		SMDMetaDataRawEditor::FOnMetaDataTextCommitted OnKeyCommitted;
+		SMDMetaDataRawEditor::FOnMetaDataTextCommitted OnValueCommitted;
+		SMDMetaDataRawEditor::FOnRemoveMetaData OnRemoveMetaData;
+	};
+}
+
+void SMDMetaDataRawEditor::Construct(const FArguments& InArgs)
+{
+	bIsReadOnly = InArgs._IsReadOnly;
+	OnGetMetaDataMap = InArgs._OnGetMetaDataMap;
+	OnKeyCommitted = InArgs._OnKeyCommitted;
+	OnValueCommitted = InArgs._OnValueCommitted;
+	OnRemoveMetaData = InArgs._OnRemoveMetaData;
+
+	UpdateEntries();
+	UpdateFilteredEntries();
+
+	ChildSlot
+	[
+		SNew(SVerticalBox)
+		+SVerticalBox::Slot()
+		.AutoHeight()
+		.Padding(0.f, 2.f)
+		[
+			SNew(SHorizontalBox)
+			+SHorizontalBox::Slot()
+			.FillWidth(1.f)
+			[
+				SNew(SSearchBox)
+				.HintText(INVTEXT("Filter meta data..."))
+				.OnTextChanged(this, &SMDMetaDataRawEditor::OnFilterTextChanged)
+			]
+			+SHorizontalBox::Slot()
+			.AutoWidth()
+			.VAlign(VAlign_Center)
+			.Padding(6.f, 0.f, 0.f, 0.f)
+			[
+				SNew(STextBlock)
+				.Font(IDetailLayoutBuilder::GetDetailFont())
+				.Text(this, &SMDMetaDataRawEditor::GetCountText)
+			]
+		]
+		+SVerticalBox::Slot()
+		.AutoHeight()
+		[
+			SNew(SBox)
+			.MaxDesiredHeight(MDMDERE_Private::MaxListHeight)
+			[
+				SAssignNew(ListView, SListView<TSharedPtr<FMDMetaDataRawEntry>>)
+				.ListItemsSource(&FilteredEntries)
+				.SelectionMode(ESelectionMode::None)
+				.OnGenerateRow(this, &SMDMetaDataRawEditor::OnGenerateRow)
+				.HeaderRow
+				(
+					SNew(SHeaderRow)
+					+SHeaderRow::Column(KeyColumnId)
+					.DefaultLabel(INVTEXT("Key"))
+					.FillWidth(0.4f)
+					.SortMode(this, &SMDMetaDataRawEditor::GetColumnSortMode, KeyColumnId)
+					.OnSort(this, &SMDMetaDataRawEditor::OnColumnSortModeChanged)
+					+SHeaderRow::Column(ValueColumnId)
+					.DefaultLabel(INVTEXT("Value"))
+					.FillWidth(0.6f)
+					.SortMode(this, &SMDMetaDataRawEditor::GetColumnSortMode, ValueColumnId)
+					.OnSort(this, &SMDMetaDataRawEditor::OnColumnSortModeChanged)
+					+SHeaderRow::Column(RemoveColumnId)
+					.DefaultLabel(FText::GetEmpty())
+					.FixedWidth(24.f)
+				)
+			]
+		]
+	];
+}
+
+void SMDMetaDataRawEditor::Tick(const FGeometry& AllottedGeometry, const double InCurrentTime, const float InDeltaTime)
+{
+	SCompoundWidget::Tick(AllottedGeometry, InCurrentTime, InDeltaTime);
+
+	// Catches changes made outside of this list (undo, other views, etc.), only while the list is visible
+	if (UpdateEntries())
+	{
+		UpdateFilteredEntries();
+	}
+}
+
+bool SMDMetaDataRawEditor::UpdateEntries()
+{
+	const TMap<FName, FString>* MetaDataMap = OnGetMetaDataMap.IsBound() ? OnGetMetaDataMap.Execute() : nullptr;
+	const int32 NumEntries = (MetaDataMap != nullptr) ? MetaDataMap->Num() : 0;
+
+	bool bIsUpToDate = (NumEntries == AllEntries.Num());
+	if (bIsUpToDate && MetaDataMap != nullptr)
+	{
+		int32 Index = 0;
+		for (const TPair<FName, FString>& Pair : *MetaDataMap)
+		{
+			const FMDMetaDataRawEntry& Entry = *AllEntries[Index++];
+			if (Entry.Key != Pair.Key || !Entry.Value.Equals(Pair.Value, ESearchCase::CaseSensitive))
+			{
+				bIsUpToDate = false;
+				break;
+			}
+		}
+	}
+
+	if (bIsUpToDate)
+	{
+		return false;
+	}
+
+	AllEntries.Reset(NumEntries);
+	if (MetaDataMap != nullptr)
+	{
+		for (const TPair<FName, FString>& Pair : *MetaDataMap)
+		{
+			TSharedRef<FMDMetaDataRawEntry> Entry = MakeShared<FMDMetaDataRawEntry>();
+			Entry->Key = Pair.Key;
+			Entry->Value = Pair.Value;
+			Entry->KeyText = FText::FromName(Pair.Key);
+			Entry->ValueText = FText::FromString(Pair.Value);
+			Entry->KeyLower = Pair.Key.ToString().ToLower();
+			Entry->ValueLower = Pair.Value.ToLower();
+			AllEntries.Add(MoveTemp(Entry));
+		}
+	}
+
+	return true;
+}
+
+void SMDMetaDataRawEditor::UpdateFilteredEntries()
+{
+	FilteredEntries.Reset(AllEntries.Num());
+
+	if (FilterLower.IsEmpty())
+	{
+		FilteredEntries = AllEntries;
+	}
+	else
+	{
+		for (const TSharedPtr<FMDMetaDataRawEntry>& Entry : AllEntries)
+		{
+			if (Entry->KeyLower.Contains(FilterLower, ESearchCase::CaseSensitive) || Entry->ValueLower.Contains(FilterLower, ESearchCase::CaseSensitive))
+			{
+				FilteredEntries.Add(Entry);
+			}
+		}
+	}
+
+	if (SortMode != EColumnSortMode::None)
+	{
+		const bool bIsAscending = (SortMode == EColumnSortMode::Ascending);
+		if (SortColumnId == KeyColumnId)
+		{
+			FilteredEntries.StableSort([bIsAscending](const TSharedPtr<FMDMetaDataRawEntry>& A, const TSharedPtr<FMDMetaDataRawEntry>& B)
+			{
+				return bIsAscending ? A->Key.LexicalLess(B->Key) : B->Key.LexicalLess(A->Key);
+			});
+		}
+		else if (SortColumnId == ValueColumnId)
+		{
+			FilteredEntries.StableSort([bIsAscending](const TSharedPtr<FMDMetaDataRawEntry>& A, const TSharedPtr<FMDMetaDataRawEntry>& B)
+			{
+				return bIsAscending ? (A->Value.Compare(B->Value, ESearchCase::IgnoreCase) < 0) : (B->Value.Compare(A->Value, ESearchCase::IgnoreCase) < 0);
+			});
+		}
+	}
+
+	CountText = (FilteredEntries.Num() == AllEntries.Num())
+		? FText::Format(INVTEXT("{0} {0}|plural(one=entry,other=entries)"), AllEntries.Num())
+		: FText::Format(INVTEXT("{0} of {1} entries"), FilteredEntries.Num(), AllEntries.Num());
+
+	if (ListView.IsValid())
+	{
+		ListView->RequestListRefresh();
+	}
+}
+
+TSharedRef<ITableRow> SMDMetaDataRawEditor::OnGenerateRow(TSharedPtr<FMDMetaDataRawEntry> Entry, const TSharedRef<STableViewBase>& OwnerTable)
+{
+	return SNew(MDMDERE_Private::SRawEntryRow, OwnerTable, Entry)
+		.IsReadOnly(bIsReadOnly)
+		.OnKeyCommitted(OnKeyCommitted)
+		.OnValueCommitted(OnValueCommitted)
+		.OnRemoveMetaData(OnRemoveMetaData);
+}
+
+void SMDMetaDataRawEditor::OnFilterTextChanged(const FText& Text)
+{
+	FilterLower = Text.ToString().TrimStartAndEnd().ToLower();
+	UpdateFilteredEntries();
+}
+
+FText SMDMetaDataRawEditor::GetCountText() const
+{
+	return CountText;
+}
+
+EColumnSortMode::Type SMDMetaDataRawEditor::GetColumnSortMode(FName ColumnId) const
+{
+	return (SortColumnId == ColumnId) ? SortMode : EColumnSortMode::None;
+}
+
+void SMDMetaDataRawEditor::OnColumnSortModeChanged(EColumnSortPriority::Type SortPriority, const FName& ColumnId, EColumnSortMode::Type InSortMode)
+{
+	SortColumnId = ColumnId;
+	SortMode = InSortMode;
+	UpdateFilteredEntries();
+}
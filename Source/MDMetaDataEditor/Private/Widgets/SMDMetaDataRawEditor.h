@@ -0,0 +1,78 @@
+// Copyright Dylan Dumesnil. All Rights Reserved.
+
+#pragma once
+
+#include "Widgets/SCompoundWidget.h"
+#include "Widgets/Views/SHeaderRow.h"
+#include "Widgets/Views/SListView.h"
+
+namespace ETextCommit
+{
+	enum Type : int;
+}
+
+// A meta data entry with its text and lowercased search strings cached so filtering and row generation don't convert them again
+struct FMDMetaDataRawEntry
+{
+	FName Key;
+	FString Value;
+	FText KeyText;
+	FText ValueText;
+	FString KeyLower;
+	FString ValueLower;
+};
+
+// Virtualized, sortable and filterable list of every raw meta data entry, only rows that are scrolled into view build widgets
+class SMDMetaDataRawEditor : public SCompoundWidget
+{
+public:
+	DECLARE_DELEGATE_RetVal(const TMap<FName, FString>*, FOnGetMetaDataMap);
+	DECLARE_DELEGATE_ThreeParams(FOnMetaDataTextCommitted, const FText&, ETextCommit::Type, FName);
+	DECLARE_DELEGATE_RetVal_OneParam(FReply, FOnRemoveMetaData, FName);
+
+	SLATE_BEGIN_ARGS(SMDMetaDataRawEditor)
+	{}
+		SLATE_ARGUMENT_DEFAULT(bool, IsReadOnly) = false;
+		SLATE_EVENT(FOnGetMetaDataMap, OnGetMetaDataMap);
+		SLATE_EVENT(FOnMetaDataTextCommitted, OnKeyCommitted);
+		SLATE_EVENT(FOnMetaDataTextCommitted, OnValueCommitted);
+		SLATE_EVENT(FOnRemoveMetaData, OnRemoveMetaData);
+	SLATE_END_ARGS()
+
+	static const FName KeyColumnId;
+	static const FName ValueColumnId;
+	static const FName RemoveColumnId;
+
+	void Construct(const FArguments& InArgs);
+
+	virtual void Tick(const FGeometry& AllottedGeometry, const double InCurrentTime, const float InDeltaTime) override;
+
+private:
+	// Returns true if the entries changed since they were last cached
+	bool UpdateEntries();
+	void UpdateFilteredEntries();
+
+	TSharedRef<ITableRow> OnGenerateRow(TSharedPtr<FMDMetaDataRawEntry> Entry, const TSharedRef<STableViewBase>& OwnerTable);
+
+	void OnFilterTextChanged(const FText& Text);
+	FText GetCountText() const;
+
+	EColumnSortMode::Type GetColumnSortMode(FName ColumnId) const;
+	void OnColumnSortModeChanged(EColumnSortPriority::Type SortPriority, const FName& ColumnId, EColumnSortMode::Type InSortMode);
+
+	bool bIsReadOnly = false;
+	FOnGetMetaDataMap OnGetMetaDataMap;
+	FOnMetaDataTextCommitted OnKeyCommitted;
+	FOnMetaDataTextCommitted OnValueCommitted;
+	FOnRemoveMetaData OnRemoveMetaData;
+
+	// In the order of the meta data map, used to detect changes to the map
+	TArray<TSharedPtr<FMDMetaDataRawEntry>> AllEntries;
+	TArray<TSharedPtr<FMDMetaDataRawEntry>> FilteredEntries;
+	TSharedPtr<SListView<TSharedPtr<FMDMetaDataRawEntry>>> ListView;
+
+	FText CountText;
+	FString FilterLower;
+	FName SortColumnId = NAME_None;
+	EColumnSortMode::Type SortMode = EColumnSortMode::None;
+};
@@ -14,6 +14,7 @@ public class MDMetaDataEditorGraph : ModuleRules
 	            "BlueprintGraph",
 	            "Core",
                 "CoreUObject",
+                "DeveloperSettings",
                 "Engine",
                 "Kismet",
                 "Slate",
@@ -0,0 +1,43 @@
+// Copyright Dylan Dumesnil. All Rights Reserved.
+
+
+#include "MDMetaDataEditorGraphConfig.h"
+
+#include "Misc/CommandLine.h"
+#include "Misc/Parse.h"
+
+FText UMDMetaDataEditorGraphConfig::GetSectionText() const
+{
+	return INVTEXT("Meta Data Editor (Compiler)");
+}
+
+bool UMDMetaDataEditorGraphConfig::ShouldSkipMetaDataPropagation() const
+{
+	if (!IsRunningCommandlet() || CommandletSkipPolicy == EMDMetaDataEditorCommandletSkipPolicy::Never)
+	{
+		return false;
+	}
+
+	if (IsRunningCookCommandlet())
+	{
+		return true;
+	}
+
+	if (CommandletSkipPolicy != EMDMetaDataEditorCommandletSkipPolicy::AllCommandlets)
+	{
+		return false;
+	}
+
+	FString CommandletName;
+	if (!FParse::Value(FCommandLine::Get(), TEXT("-run="), CommandletName))
+	{
+		return true;
+	}
+
+	CommandletName.RemoveFromEnd(TEXT("Commandlet"));
+	return !CommandletsRequiringMetaData.ContainsByPredicate([&CommandletName](FString AllowedName)
+	{
+		AllowedName.RemoveFromEnd(TEXT("Commandlet"));
+		return AllowedName.Equals(CommandletName, ESearchCase::IgnoreCase);
+	});
+}
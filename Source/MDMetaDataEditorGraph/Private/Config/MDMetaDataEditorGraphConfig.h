@@ -0,0 +1,47 @@
+// Copyright Dylan Dumesnil. All Rights Reserved.
+
+#pragma once
+
+#include "Engine/DeveloperSettings.h"
+#include "MDMetaDataEditorGraphConfig.generated.h"
+
+UENUM()
+enum class EMDMetaDataEditorCommandletSkipPolicy : uint8
+{
+	// Always propagate meta data onto compiled Blueprints
+	Never,
+	// Skip while cooking, cooked Blueprints don't keep editor-only meta data
+	Cooking,
+	// Skip while cooking and in any commandlet that isn't listed in Commandlets Requiring Meta Data.
+	// Commandlets that save Blueprints (like ResavePackages) must be listed, otherwise the saved Blueprints lose their param meta data.
+	AllCommandlets
+};
+
+/**
+ * Configure how meta data is propagated onto compiled Blueprint functions.
+ */
+UCLASS(DefaultConfig, Config = Editor, MinimalAPI)
+class UMDMetaDataEditorGraphConfig : public UDeveloperSettings
+{
+	GENERATED_BODY()
+
+public:
+	virtual FText GetSectionText() const override;
+
+	// If true, function param and local variable meta data is resolved for all Blueprints in a compile batch at once, across worker threads.
+	// The meta data is applied once the batch finishes compiling instead of as each Blueprint compiles, which speeds up large batch compiles (loading, cooking, C++ parent changes).
+	// Because of that, the Blueprints' OnCompiled listeners (and OnBlueprintCompiled listeners bound before this extension) see the new functions without their param and local variable meta data.
+	UPROPERTY(EditDefaultsOnly, Config, Category = "Compiler")
+	bool bEnableParallelMetaDataPropagation = false;
+
+	// When to skip propagating function param and local variable meta data onto compiled Blueprints to speed up commandlets
+	UPROPERTY(EditDefaultsOnly, Config, Category = "Compiler")
+	EMDMetaDataEditorCommandletSkipPolicy CommandletSkipPolicy = EMDMetaDataEditorCommandletSkipPolicy::Cooking;
+
+	// Commandlets that always propagate meta data when using the All Commandlets skip policy, matched against the -run= name with or without the Commandlet suffix
+	UPROPERTY(EditDefaultsOnly, Config, Category = "Compiler", meta = (EditCondition = "CommandletSkipPolicy == EMDMetaDataEditorCommandletSkipPolicy::AllCommandlets"))
+	TArray<FString> CommandletsRequiringMetaData = { TEXT("DataValidation"), TEXT("ResavePackages"), TEXT("GatherText") };
+
+	// Returns true if the running process shouldn't propagate meta data onto compiled Blueprints
+	bool ShouldSkipMetaDataPropagation() const;
+};
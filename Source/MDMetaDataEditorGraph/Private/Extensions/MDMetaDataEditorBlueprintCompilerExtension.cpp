@@ -2,38 +2,104 @@
 
 #include "MDMetaDataEditorBlueprintCompilerExtension.h"
 
+#include "Async/ParallelFor.h"
+#include "Config/MDMetaDataEditorGraphConfig.h"
+#include "Editor.h"
 #include "Engine/BlueprintGeneratedClass.h"
 #include "K2Node_FunctionEntry.h"
+#include "MDMetaDataEditorGraph.h"
+
+DECLARE_CYCLE_STAT(TEXT("Process Blueprint Compiled"), STAT_MDMetaDataEditor_ProcessBlueprintCompiled, STATGROUP_MDMetaDataEditor);
+DECLARE_CYCLE_STAT(TEXT("Flush Pending Meta Data"), STAT_MDMetaDataEditor_FlushPendingMetaData, STATGROUP_MDMetaDataEditor);
+DECLARE_FLOAT_ACCUMULATOR_STAT(TEXT("Parallel Meta Data Time Saved (ms)"), STAT_MDMetaDataEditor_ParallelTimeSaved, STATGROUP_MDMetaDataEditor);
 
 namespace MDMDEBCE_Private
 {
-	FProperty* FindNodePropertyInClass(const UK2Node_FunctionEntry& FunctionNode, const FName& PropertyName, const UClass* Class)
+	FName GetFunctionName(const UK2Node_FunctionEntry& FunctionNode)
 	{
-		const FName FunctionName = (FunctionNode.CustomGeneratedFunctionName != NAME_None)
+		return (FunctionNode.CustomGeneratedFunctionName != NAME_None)
 			? FunctionNode.CustomGeneratedFunctionName : FunctionNode.GetGraph()->GetFName();
-		const UFunction*Function = Class->FindFunctionByName(FunctionName);
+	}
+
+	void GatherNodePropertiesInClass(const UK2Node_FunctionEntry& FunctionNode, const UClass* Class, TMap<FName, const FProperty*>& OutProperties)
+	{
+		const UFunction* Function = Class->FindFunctionByName(GetFunctionName(FunctionNode));
 
-		if (!IsValid(Function))
+		// Class may be an old class that was already marked as garbage, along with its functions
+		if (Function == nullptr)
 		{
-			return nullptr;
+			return;
 		}
 
 		// Can't use Function->FindPropertyByName here since Function->PropertyLink is null
 		for (FField* Field = Function->ChildProperties; Field != nullptr; Field = Field->Next)
 		{
-			if (Field->GetFName() == PropertyName)
+			if (const FProperty* Property = CastField<FProperty>(Field))
+			{
+				// Keep the first match like a linear search would
+				if (!OutProperties.Contains(Property->GetFName()))
+				{
+					OutProperties.Add(Property->GetFName(), Property);
+				}
+			}
+		}
+	}
+
+	// Counts the meta data entries on params of functions declared by Class, which is what gets copied onto the newly compiled functions
+	int32 CountFunctionParamMetaData(const UClass* Class)
+	{
+		int32 Count = 0;
+		for (TFieldIterator<UFunction> FunctionIt(Class, EFieldIteratorFlags::ExcludeSuper); FunctionIt; ++FunctionIt)
+		{
+			for (const FField* Field = FunctionIt->ChildProperties; Field != nullptr; Field = Field->Next)
 			{
-				return CastField<FProperty>(Field);
+				const FProperty* Property = CastField<FProperty>(Field);
+				if (Property != nullptr && Property->HasAnyPropertyFlags(CPF_Parm))
+				{
+					if (const TMap<FName, FString>* MetaDataMap = Property->GetMetaDataMap())
+					{
+						Count += MetaDataMap->Num();
+					}
+				}
 			}
 		}
 
-		return nullptr;
+		return Count;
 	}
 
-	// Inits meta data on function-related properties (params & variables) that the engine doesn't already support
-	void InitFunctionNodeMetaData(const UK2Node_FunctionEntry& FunctionNode, const UClass* OldClass, const UBlueprint* Blueprint)
+	// A meta data write onto a compiled function property, copied from either an old class param or a local variable description
+	struct FMetaDataWorkItem
 	{
-		auto InitFunctionMetaData = [&FunctionNode, &OldClass](const UFunction* Function)
+		FProperty* Property = nullptr;
+		const FProperty* SourceProperty = nullptr;
+		const FBPVariableDescription* SourceVariable = nullptr;
+	};
+
+	// Gathers the meta data to init on function-related properties (params & variables) that the engine doesn't already support.
+	// Only reads from the node and classes, so it is safe to run for several Blueprints in parallel.
+	void GatherFunctionNodeMetaData(const UK2Node_FunctionEntry& FunctionNode, const UFunction* Function, const UFunction* SkeletonFunction, const UClass* OldClass, bool bCopyParamMetaData, TArray<FMetaDataWorkItem>& OutWorkItems)
+	{
+		// Built once per node and shared by the generated and skeleton functions, only local variables with meta data need to be applied
+		TMap<FName, const FBPVariableDescription*> LocalVariablesWithMetaData;
+		LocalVariablesWithMetaData.Reserve(FunctionNode.LocalVariables.Num());
+		for (const FBPVariableDescription& Variable : FunctionNode.LocalVariables)
+		{
+			if (!Variable.MetaDataArray.IsEmpty())
+			{
+				LocalVariablesWithMetaData.Add(Variable.VarName, &Variable);
+			}
+		}
+
+		if (LocalVariablesWithMetaData.IsEmpty() && !bCopyParamMetaData)
+		{
+			return;
+		}
+
+		// Built on first use and shared by the generated and skeleton functions
+		TMap<FName, const FProperty*> OldClassProperties;
+		bool bHasGatheredOldClassProperties = false;
+
+		auto GatherFunctionMetaData = [&FunctionNode, &OldClass, bCopyParamMetaData, &LocalVariablesWithMetaData, &OldClassProperties, &bHasGatheredOldClassProperties, &OutWorkItems](const UFunction* Function)
 		{
 			if (!IsValid(Function))
 			{
@@ -62,46 +128,56 @@ namespace MDMDEBCE_Private
 
 				if (Prop->HasAnyPropertyFlags(CPF_Parm))
 				{
-					if (IsValid(OldClass))
+					// Not IsValid, the old class is usually marked as garbage by the time a deferred flush runs but is still intact until it's collected
+					if (bCopyParamMetaData && OldClass != nullptr)
 					{
-						if (const FProperty* OldProperty = FindNodePropertyInClass(FunctionNode, Prop->GetFName(), OldClass))
+						if (!bHasGatheredOldClassProperties)
 						{
-							FField::CopyMetaData(OldProperty, Prop);
-						}
-					}
-				}
-				else
-				{
-					for (const FBPVariableDescription& Variable : FunctionNode.LocalVariables)
-					{
-						if (Variable.MetaDataArray.IsEmpty())
-						{
-							continue;
+							GatherNodePropertiesInClass(FunctionNode, OldClass, OldClassProperties);
+							bHasGatheredOldClassProperties = true;
 						}
 
-						if (Prop->GetFName() == Variable.VarName)
+						if (const FProperty* const* OldProperty = OldClassProperties.Find(Prop->GetFName()))
 						{
-							for (const FBPVariableMetaDataEntry& Entry : Variable.MetaDataArray)
-							{
-								Prop->SetMetaData(Entry.DataKey, *Entry.DataValue);
-							}
+							OutWorkItems.Add({ Prop, *OldProperty, nullptr });
 						}
 					}
 				}
+				else if (const FBPVariableDescription* const* Variable = LocalVariablesWithMetaData.Find(Prop->GetFName()))
+				{
+					OutWorkItems.Add({ Prop, nullptr, *Variable });
+				}
 			}
 		};
 
-		const FName FunctionName = (FunctionNode.CustomGeneratedFunctionName != NAME_None)
-			? FunctionNode.CustomGeneratedFunctionName : FunctionNode.GetGraph()->GetFName();
-		const UFunction* Function = IsValid(Blueprint->GeneratedClass) ? Blueprint->GeneratedClass->FindFunctionByName(FunctionName) : nullptr;
-		const UFunction* SkeletonFunction = IsValid(Blueprint->SkeletonGeneratedClass) ? Blueprint->SkeletonGeneratedClass->FindFunctionByName(FunctionName) : nullptr;
-		InitFunctionMetaData(Function);
-		InitFunctionMetaData(SkeletonFunction);
+		GatherFunctionMetaData(Function);
+		GatherFunctionMetaData(SkeletonFunction);
+	}
+
+	// Writing FField meta data isn't thread safe, so this is always called on the game thread
+	void ApplyMetaDataWorkItems(const TArray<FMetaDataWorkItem>& WorkItems)
+	{
+		for (const FMetaDataWorkItem& WorkItem : WorkItems)
+		{
+			if (WorkItem.SourceProperty != nullptr)
+			{
+				FField::CopyMetaData(WorkItem.SourceProperty, WorkItem.Property);
+			}
+			else if (WorkItem.SourceVariable != nullptr)
+			{
+				for (const FBPVariableMetaDataEntry& Entry : WorkItem.SourceVariable->MetaDataArray)
+				{
+					WorkItem.Property->SetMetaData(Entry.DataKey, *Entry.DataValue);
+				}
+			}
+		}
 	}
 }
 
 void UMDMetaDataEditorBlueprintCompilerExtension::ProcessBlueprintCompiled(const FKismetCompilerContext& CompilationContext, const FBlueprintCompiledData& Data)
 {
+	MDMDEG_SCOPE_CYCLE_COUNTER(STAT_MDMetaDataEditor_ProcessBlueprintCompiled);
+
 	Super::ProcessBlueprintCompiled(CompilationContext, Data);
 
 	if (!IsValid(CompilationContext.Blueprint))
@@ -109,12 +185,106 @@ void UMDMetaDataEditorBlueprintCompilerExtension::ProcessBlueprintCompiled(const
 		return;
 	}
 
-	TArray<TObjectPtr<UEdGraph>> Graphs = CompilationContext.Blueprint->FunctionGraphs;
-	Graphs.Append(CompilationContext.Blueprint->EventGraphs);
+	if (ShouldSkipMetaDataPropagation())
+	{
+		++NumSkippedBlueprints;
+		return;
+	}
 
-	for (UEdGraph* Graph : Graphs)
+	UBlueprint* Blueprint = CompilationContext.Blueprint;
+
+	// Blueprints without any param or local variable meta data (most of them) are skipped cheaply
+	const FBlueprintFingerprint& Fingerprint = FindOrUpdateFingerprint(Blueprint, CompilationContext.OldClass);
+	if (Fingerprint.NumLocalMetaDataEntries == 0 && Fingerprint.NumParamMetaDataEntries == 0)
 	{
-		for (UEdGraphNode* GraphNode : Graph->Nodes)
+		return;
+	}
+
+	const int32 NumParamMetaDataEntries = Fingerprint.NumParamMetaDataEntries;
+
+	TArray<const UK2Node_FunctionEntry*, TInlineAllocator<32>> FunctionNodes;
+	for (const TWeakObjectPtr<const UK2Node_FunctionEntry>& FunctionNode : Fingerprint.FunctionNodes)
+	{
+		if (FunctionNode.IsValid())
+		{
+			FunctionNodes.Add(FunctionNode.Get());
+		}
+	}
+
+	const UClass* GeneratedClass = IsValid(Blueprint->GeneratedClass) ? Blueprint->GeneratedClass.Get() : nullptr;
+	const UClass* SkeletonClass = IsValid(Blueprint->SkeletonGeneratedClass) ? Blueprint->SkeletonGeneratedClass.Get() : nullptr;
+
+	if (GetDefault<UMDMetaDataEditorGraphConfig>()->bEnableParallelMetaDataPropagation)
+	{
+		// A Blueprint compiling again before its meta data was applied would copy from an old class that's missing it
+		if (PendingBlueprints.ContainsByPredicate([Blueprint](const FPendingBlueprint& Pending) { return Pending.Blueprint == Blueprint; }))
+		{
+			FlushPendingMetaData();
+		}
+
+		FPendingBlueprint& Pending = PendingBlueprints.AddDefaulted_GetRef();
+		Pending.Blueprint = Blueprint;
+		Pending.OldClass = CompilationContext.OldClass;
+		Pending.bCopyParamMetaData = NumParamMetaDataEntries > 0;
+		Pending.Functions.Reserve(FunctionNodes.Num());
+		for (const UK2Node_FunctionEntry* FunctionNode : FunctionNodes)
+		{
+			const FName FunctionName = MDMDEBCE_Private::GetFunctionName(*FunctionNode);
+			Pending.Functions.Add({
+				FunctionNode,
+				GeneratedClass != nullptr ? GeneratedClass->FindFunctionByName(FunctionName) : nullptr,
+				SkeletonClass != nullptr ? SkeletonClass->FindFunctionByName(FunctionName) : nullptr
+			});
+		}
+
+		RegisterFlushHooks();
+		return;
+	}
+
+	TArray<MDMDEBCE_Private::FMetaDataWorkItem> WorkItems;
+	for (const UK2Node_FunctionEntry* FunctionNode : FunctionNodes)
+	{
+		const FName FunctionName = MDMDEBCE_Private::GetFunctionName(*FunctionNode);
+		const UFunction* Function = GeneratedClass != nullptr ? GeneratedClass->FindFunctionByName(FunctionName) : nullptr;
+		const UFunction* SkeletonFunction = SkeletonClass != nullptr ? SkeletonClass->FindFunctionByName(FunctionName) : nullptr;
+
+		WorkItems.Reset();
+		MDMDEBCE_Private::GatherFunctionNodeMetaData(*FunctionNode, Function, SkeletonFunction, CompilationContext.OldClass, NumParamMetaDataEntries > 0, WorkItems);
+		MDMDEBCE_Private::ApplyMetaDataWorkItems(WorkItems);
+	}
+}
+
+const UMDMetaDataEditorBlueprintCompilerExtension::FBlueprintFingerprint& UMDMetaDataEditorBlueprintCompilerExtension::FindOrUpdateFingerprint(UBlueprint* Blueprint, const UClass* OldClass)
+{
+	if (!ObjectModifiedHandle.IsValid())
+	{
+		ObjectModifiedHandle = FCoreUObjectDelegates::OnObjectModified.AddUObject(this, &UMDMetaDataEditorBlueprintCompilerExtension::OnObjectModified);
+		PostGarbageCollectHandle = FCoreUObjectDelegates::GetPostGarbageCollect().AddUObject(this, &UMDMetaDataEditorBlueprintCompilerExtension::OnPostGarbageCollect);
+	}
+
+	FBlueprintFingerprint& Fingerprint = Fingerprints.FindOrAdd(Blueprint);
+	if (!Fingerprint.Blueprint.IsValid())
+	{
+		Fingerprint.Blueprint = Blueprint;
+		Blueprint->OnChanged().AddUObject(this, &UMDMetaDataEditorBlueprintCompilerExtension::OnBlueprintChanged);
+	}
+
+	if (!Fingerprint.bIsDirty)
+	{
+		return Fingerprint;
+	}
+
+	// Only function graphs have entry nodes, and each only has one so the node walk stops as soon as it's found
+	Fingerprint.FunctionNodes.Reset();
+	Fingerprint.NumLocalMetaDataEntries = 0;
+	for (const UEdGraph* Graph : Blueprint->FunctionGraphs)
+	{
+		if (!IsValid(Graph))
+		{
+			continue;
+		}
+
+		for (const UEdGraphNode* GraphNode : Graph->Nodes)
 		{
 			const UK2Node_FunctionEntry* FunctionNode = Cast<UK2Node_FunctionEntry>(GraphNode);
 			if (!IsValid(FunctionNode))
@@ -122,7 +292,262 @@ void UMDMetaDataEditorBlueprintCompilerExtension::ProcessBlueprintCompiled(const
 				continue;
 			}
 
-			MDMDEBCE_Private::InitFunctionNodeMetaData(*FunctionNode, CompilationContext.OldClass, CompilationContext.Blueprint);
+			Fingerprint.FunctionNodes.Add(FunctionNode);
+			for (const FBPVariableDescription& Variable : FunctionNode->LocalVariables)
+			{
+				Fingerprint.NumLocalMetaDataEntries += Variable.MetaDataArray.Num();
+			}
+			break;
+		}
+	}
+
+	// Each compile copies the old class's param meta data onto the new class, so the count carries over between compiles until an edit dirties it
+	Fingerprint.NumParamMetaDataEntries = IsValid(OldClass) ? MDMDEBCE_Private::CountFunctionParamMetaData(OldClass) : 0;
+	Fingerprint.bIsDirty = false;
+
+	return Fingerprint;
+}
+
+void UMDMetaDataEditorBlueprintCompilerExtension::ResetFingerprints()
+{
+	for (const TPair<TObjectKey<UBlueprint>, FBlueprintFingerprint>& Pair : Fingerprints)
+	{
+		if (UBlueprint* Blueprint = Pair.Value.Blueprint.Get())
+		{
+			Blueprint->OnChanged().RemoveAll(this);
+		}
+	}
+
+	Fingerprints.Reset();
+
+	FCoreUObjectDelegates::OnObjectModified.Remove(ObjectModifiedHandle);
+	ObjectModifiedHandle.Reset();
+
+	FCoreUObjectDelegates::GetPostGarbageCollect().Remove(PostGarbageCollectHandle);
+	PostGarbageCollectHandle.Reset();
+}
+
+void UMDMetaDataEditorBlueprintCompilerExtension::OnBlueprintChanged(UBlueprint* Blueprint)
+{
+	if (FBlueprintFingerprint* Fingerprint = Fingerprints.Find(Blueprint))
+	{
+		Fingerprint->bIsDirty = true;
+	}
+}
+
+void UMDMetaDataEditorBlueprintCompilerExtension::OnObjectModified(UObject* Object)
+{
+	// Called for every modified object in the editor, so bail out before any lookups for unrelated objects
+	if (Fingerprints.IsEmpty() || Object == nullptr)
+	{
+		return;
+	}
+
+	UBlueprint* Blueprint = Cast<UBlueprint>(Object);
+	if (Blueprint == nullptr)
+	{
+		if (const UK2Node_FunctionEntry* FunctionNode = Cast<UK2Node_FunctionEntry>(Object))
+		{
+			Blueprint = FunctionNode->GetTypedOuter<UBlueprint>();
+		}
+		else if (const UFunction* Function = Cast<UFunction>(Object))
+		{
+			Blueprint = UBlueprint::GetBlueprintFromClass(Function->GetOwnerClass());
+		}
+	}
+
+	if (Blueprint != nullptr)
+	{
+		OnBlueprintChanged(Blueprint);
+	}
+}
+
+void UMDMetaDataEditorBlueprintCompilerExtension::OnPostGarbageCollect()
+{
+	for (auto It = Fingerprints.CreateIterator(); It; ++It)
+	{
+		if (!It.Value().Blueprint.IsValid())
+		{
+			It.RemoveCurrent();
+		}
+	}
+}
+
+void UMDMetaDataEditorBlueprintCompilerExtension::FlushPendingMetaData()
+{
+	if (PendingBlueprints.IsEmpty())
+	{
+		return;
+	}
+
+	MDMDEG_SCOPE_CYCLE_COUNTER(STAT_MDMetaDataEditor_FlushPendingMetaData);
+
+	struct FResolvedFunction
+	{
+		const UK2Node_FunctionEntry* FunctionNode = nullptr;
+		const UFunction* Function = nullptr;
+		const UFunction* SkeletonFunction = nullptr;
+	};
+
+	struct FResolvedBlueprint
+	{
+		const UClass* OldClass = nullptr;
+		TArray<FResolvedFunction> Functions;
+		bool bCopyParamMetaData = false;
+
+		TArray<MDMDEBCE_Private::FMetaDataWorkItem> WorkItems;
+		double GatherSeconds = 0;
+	};
+
+	// Weak pointers are resolved on the game thread so the workers only see raw pointers
+	TArray<FResolvedBlueprint> ResolvedBlueprints;
+	ResolvedBlueprints.Reserve(PendingBlueprints.Num());
+	for (const FPendingBlueprint& Pending : PendingBlueprints)
+	{
+		if (!Pending.Blueprint.IsValid())
+		{
+			continue;
+		}
+
+		FResolvedBlueprint& Resolved = ResolvedBlueprints.AddDefaulted_GetRef();
+		Resolved.OldClass = Pending.OldClass;
+		Resolved.bCopyParamMetaData = Pending.bCopyParamMetaData;
+		if (Resolved.bCopyParamMetaData && Resolved.OldClass == nullptr)
+		{
+			UE_LOG(LogMDMetaDataEditorGraph, Warning, TEXT("The old class of [%s] was destroyed before its function param meta data could be propagated"), *GetPathNameSafe(Pending.Blueprint.Get()));
+		}
+
+		for (const FPendingFunction& PendingFunction : Pending.Functions)
+		{
+			if (const UK2Node_FunctionEntry* FunctionNode = PendingFunction.FunctionNode.Get())
+			{
+				Resolved.Functions.Add({ FunctionNode, PendingFunction.Function.Get(), PendingFunction.SkeletonFunction.Get() });
+			}
+		}
+	}
+
+	PendingBlueprints.Reset();
+
+	const double StartTime = FPlatformTime::Seconds();
+
+	ParallelFor(ResolvedBlueprints.Num(), [&ResolvedBlueprints](int32 Index)
+	{
+		FResolvedBlueprint& Resolved = ResolvedBlueprints[Index];
+		const double GatherStartTime = FPlatformTime::Seconds();
+		for (const FResolvedFunction& Function : Resolved.Functions)
+		{
+			MDMDEBCE_Private::GatherFunctionNodeMetaData(*Function.FunctionNode, Function.Function, Function.SkeletonFunction, Resolved.OldClass, Resolved.bCopyParamMetaData, Resolved.WorkItems);
 		}
+		Resolved.GatherSeconds = FPlatformTime::Seconds() - GatherStartTime;
+	});
+
+	const double GatherWallSeconds = FPlatformTime::Seconds() - StartTime;
+
+	double GatherSerialSeconds = 0;
+	int32 NumWorkItems = 0;
+	for (const FResolvedBlueprint& Resolved : ResolvedBlueprints)
+	{
+		MDMDEBCE_Private::ApplyMetaDataWorkItems(Resolved.WorkItems);
+		GatherSerialSeconds += Resolved.GatherSeconds;
+		NumWorkItems += Resolved.WorkItems.Num();
+	}
+
+	// Estimated against gathering every Blueprint one after the other, which is what the serial mode does
+	const double SecondsSaved = FMath::Max(0.0, GatherSerialSeconds - GatherWallSeconds);
+	TotalParallelSecondsSaved += SecondsSaved;
+	INC_FLOAT_STAT_BY(STAT_MDMetaDataEditor_ParallelTimeSaved, static_cast<float>(SecondsSaved * 1000.0));
+
+	UE_LOG(LogMDMetaDataEditorGraph, Verbose, TEXT("Propagated %d meta data item(s) for %d Blueprint(s) in %.3f ms, saving an estimated %.3f ms (%.3f ms total)"),
+		NumWorkItems, ResolvedBlueprints.Num(), (FPlatformTime::Seconds() - StartTime) * 1000.0, SecondsSaved * 1000.0, TotalParallelSecondsSaved * 1000.0);
+}
+
+void UMDMetaDataEditorBlueprintCompilerExtension::BeginDestroy()
+{
+	UnregisterFlushHooks();
+	ResetFingerprints();
+
+	Super::BeginDestroy();
+}
+
+void UMDMetaDataEditorBlueprintCompilerExtension::AddReferencedObjects(UObject* InThis, FReferenceCollector& Collector)
+{
+	UMDMetaDataEditorBlueprintCompilerExtension* This = CastChecked<UMDMetaDataEditorBlueprintCompilerExtension>(InThis);
+	for (FPendingBlueprint& Pending : This->PendingBlueprints)
+	{
+		Collector.AddReferencedObject(Pending.OldClass, This);
+	}
+
+	Super::AddReferencedObjects(InThis, Collector);
+}
+
+void UMDMetaDataEditorBlueprintCompilerExtension::Shutdown()
+{
+	FlushPendingMetaData();
+	UnregisterFlushHooks();
+	ResetFingerprints();
+
+	if (NumSkippedBlueprints > 0)
+	{
+		UE_LOG(LogMDMetaDataEditorGraph, Log, TEXT("Skipped meta data propagation for %d compiled Blueprint(s) with commandlet skip policy [%s]"),
+			NumSkippedBlueprints, *UEnum::GetValueAsString(GetDefault<UMDMetaDataEditorGraphConfig>()->CommandletSkipPolicy));
+	}
+
+	if (TotalParallelSecondsSaved > 0)
+	{
+		UE_LOG(LogMDMetaDataEditorGraph, Log, TEXT("Parallel meta data propagation saved an estimated %.3f ms this session"), TotalParallelSecondsSaved * 1000.0);
+	}
+}
+
+void UMDMetaDataEditorBlueprintCompilerExtension::RegisterFlushHooks()
+{
+	// Flush at the end of each compile batch, before the old classes can be garbage collected, and at worst on the next tick
+	if (GEditor != nullptr && !BlueprintCompiledHandle.IsValid())
+	{
+		BlueprintCompiledHandle = GEditor->OnBlueprintCompiled().AddUObject(this, &UMDMetaDataEditorBlueprintCompilerExtension::FlushPendingMetaData);
+	}
+
+	if (!PreGarbageCollectHandle.IsValid())
+	{
+		PreGarbageCollectHandle = FCoreUObjectDelegates::GetPreGarbageCollectDelegate().AddUObject(this, &UMDMetaDataEditorBlueprintCompilerExtension::FlushPendingMetaData);
 	}
+
+	if (!TickerHandle.IsValid())
+	{
+		TickerHandle = FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateUObject(this, &UMDMetaDataEditorBlueprintCompilerExtension::OnTick));
+	}
+}
+
+void UMDMetaDataEditorBlueprintCompilerExtension::UnregisterFlushHooks()
+{
+	if (GEditor != nullptr)
+	{
+		GEditor->OnBlueprintCompiled().Remove(BlueprintCompiledHandle);
+	}
+	BlueprintCompiledHandle.Reset();
+
+	FCoreUObjectDelegates::GetPreGarbageCollectDelegate().Remove(PreGarbageCollectHandle);
+	PreGarbageCollectHandle.Reset();
+
+	FTSTicker::GetCoreTicker().RemoveTicker(TickerHandle);
+	TickerHandle.Reset();
+}
+
+bool UMDMetaDataEditorBlueprintCompilerExtension::ShouldSkipMetaDataPropagation()
+{
+	if (!bHasCheckedSkipPolicy)
+	{
+		bSkipMetaDataPropagation = GetDefault<UMDMetaDataEditorGraphConfig>()->ShouldSkipMetaDataPropagation();
+		bHasCheckedSkipPolicy = true;
+	}
+
+	return bSkipMetaDataPropagation;
+}
+
+bool UMDMetaDataEditorBlueprintCompilerExtension::OnTick(float DeltaTime)
+{
+	FlushPendingMetaData();
+
+	// Re-added the next time a Blueprint is queued
+	TickerHandle.Reset();
+	return false;
 }
@@ -3,8 +3,11 @@
 #pragma once
 
 #include "BlueprintCompilerExtension.h"
+#include "Containers/Ticker.h"
+#include "UObject/ObjectKey.h"
 #include "MDMetaDataEditorBlueprintCompilerExtension.generated.h"
 
+class UK2Node_FunctionEntry;
 
 /**
  * Compiler extension to copy meta data into function local variable properties
@@ -15,5 +18,76 @@ class UMDMetaDataEditorBlueprintCompilerExtension : public UBlueprintCompilerExt
 	GENERATED_BODY()
 
 public:
+	virtual void BeginDestroy() override;
+	static void AddReferencedObjects(UObject* InThis, FReferenceCollector& Collector);
+
 	virtual void ProcessBlueprintCompiled(const FKismetCompilerContext& CompilationContext, const FBlueprintCompiledData& Data) override;
+
+	// Resolves and applies the meta data of every Blueprint queued by the parallel propagation mode
+	void FlushPendingMetaData();
+
+	// Flushes any queued meta data and logs a summary of the session, called when the module shuts down
+	void Shutdown();
+
+private:
+	// The functions are captured when the Blueprint compiles so a later recompile can't redirect the meta data to its new functions
+	struct FPendingFunction
+	{
+		TWeakObjectPtr<const UK2Node_FunctionEntry> FunctionNode;
+		TWeakObjectPtr<const UFunction> Function;
+		TWeakObjectPtr<const UFunction> SkeletonFunction;
+	};
+
+	// A compiled Blueprint whose meta data hasn't been propagated yet.
+	// The old class is referenced strongly since it's usually marked as garbage once it's replaced, which a weak pointer would resolve to null.
+	struct FPendingBlueprint
+	{
+		TWeakObjectPtr<const UBlueprint> Blueprint;
+		TObjectPtr<UClass> OldClass;
+		TArray<FPendingFunction> Functions;
+		bool bCopyParamMetaData = false;
+	};
+
+	// How much param and local variable meta data a Blueprint has, cached so compiling a Blueprint without any stays cheap.
+	// Dirtied when the Blueprint broadcasts a change or when it, one of its entry nodes or one of its functions is modified (which meta data edits do).
+	struct FBlueprintFingerprint
+	{
+		TWeakObjectPtr<UBlueprint> Blueprint;
+		// The entry node of each function graph
+		TArray<TWeakObjectPtr<const UK2Node_FunctionEntry>> FunctionNodes;
+		int32 NumLocalMetaDataEntries = 0;
+		int32 NumParamMetaDataEntries = 0;
+		bool bIsDirty = true;
+	};
+
+	const FBlueprintFingerprint& FindOrUpdateFingerprint(UBlueprint* Blueprint, const UClass* OldClass);
+	void ResetFingerprints();
+
+	void OnBlueprintChanged(UBlueprint* Blueprint);
+	void OnObjectModified(UObject* Object);
+	void OnPostGarbageCollect();
+
+	void RegisterFlushHooks();
+	void UnregisterFlushHooks();
+
+	bool OnTick(float DeltaTime);
+
+	// The skip policy only depends on the running commandlet so it's checked once
+	bool ShouldSkipMetaDataPropagation();
+
+	TArray<FPendingBlueprint> PendingBlueprints;
+
+	TMap<TObjectKey<UBlueprint>, FBlueprintFingerprint> Fingerprints;
+	FDelegateHandle ObjectModifiedHandle;
+	FDelegateHandle PostGarbageCollectHandle;
+
+	FDelegateHandle BlueprintCompiledHandle;
+	FDelegateHandle PreGarbageCollectHandle;
+	FTSTicker::FDelegateHandle TickerHandle;
+
+	double TotalParallelSecondsSaved = 0;
+
+	bool bHasCheckedSkipPolicy = false;
+	bool bSkipMetaDataPropagation = false;
+	int32 NumSkippedBlueprints = 0;
 };
@@ -2,8 +2,13 @@
 
 #include "BlueprintCompilationManager.h"
 #include "Extensions/MDMetaDataEditorBlueprintCompilerExtension.h"
+#include "MDMetaDataEditorGraph.h"
 #include "Modules/ModuleManager.h"
 
+DEFINE_LOG_CATEGORY(LogMDMetaDataEditorGraph);
+
+UE_TRACE_CHANNEL_DEFINE(MDMetaDataEditorGraphChannel);
+
 
 class FMDMetaDataEditorGraphModule : public IModuleInterface
 {
@@ -20,6 +25,7 @@ public:
 	{
 		if (UMDMetaDataEditorBlueprintCompilerExtension* CompilerExtension = CompilerExtensionPtr.Get())
 		{
+			CompilerExtension->Shutdown();
 			CompilerExtension->RemoveFromRoot();
 			CompilerExtension = nullptr;
 		}
@@ -0,0 +1,20 @@
+// Copyright Dylan Dumesnil. All Rights Reserved.
+
+#pragma once
+
+#include "Logging/LogMacros.h"
+#include "ProfilingDebugging/CpuProfilerTrace.h"
+#include "Stats/Stats.h"
+#include "Trace/Trace.h"
+
+DECLARE_LOG_CATEGORY_EXTERN(LogMDMetaDataEditorGraph, Log, All);
+
+// Run with -trace=cpu,MDMetaDataEditorGraph to see the compiler extension's scopes in Unreal Insights
+UE_TRACE_CHANNEL_EXTERN(MDMetaDataEditorGraphChannel);
+
+DECLARE_STATS_GROUP(TEXT("MDMetaDataEditor"), STATGROUP_MDMetaDataEditor, STATCAT_Advanced);
+
+// Times the scope as both a stat and an Insights event on the compiler extension's trace channel
+#define MDMDEG_SCOPE_CYCLE_COUNTER(Stat) \
+	SCOPE_CYCLE_COUNTER(Stat); \
+	TRACE_CPUPROFILER_EVENT_SCOPE_ON_CHANNEL(Stat, MDMetaDataEditorGraphChannel)